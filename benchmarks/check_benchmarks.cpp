@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "double_linked_list.hpp"
+#include "vector.hpp"
+
+// Собирается в трёх исполняемых файлах, по одному на CONTAINERS_CHECK_LEVEL
+// (containers_check_benchmarks_none, _assert, _throw). Сумма через
+// operator[] векторизуется только там, где проверка индекса исчезает
+
+namespace {
+
+constexpr size_t kSize = 1 << 16;
+
+vector::Vector<std::int32_t> make_values() {
+  vector::Vector<std::int32_t> values;
+  values.resize(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    values[i] = static_cast<std::int32_t>(i);
+  }
+  return values;
+}
+
+void BM_SumSubscript(benchmark::State &state) {
+  auto values = make_values();
+  for (auto _ : state) {
+    std::int32_t sum = 0;
+    for (size_t i = 0; i < kSize; ++i) {
+      sum += values[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SumSubscript);
+
+void BM_SumAt(benchmark::State &state) {
+  auto values = make_values();
+  for (auto _ : state) {
+    std::int32_t sum = 0;
+    for (size_t i = 0; i < kSize; ++i) {
+      sum += values.at(i);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SumAt);
+
+// Обход через data() не проверяется ни в одном режиме
+void BM_SumData(benchmark::State &state) {
+  auto values = make_values();
+  for (auto _ : state) {
+    const std::int32_t *data = values.data();
+    std::int32_t sum = 0;
+    for (size_t i = 0; i < kSize; ++i) {
+      sum += data[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SumData);
+
+void BM_ListSubscript(benchmark::State &state) {
+  double_linked_list::DoubleLinkedList<int> list;
+  for (int i = 0; i < 64; ++i) {
+    list.push_back(i);
+  }
+  for (auto _ : state) {
+    int sum = 0;
+    for (size_t i = 0; i < list.size(); ++i) {
+      sum += list[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_ListSubscript);
+
+} // namespace
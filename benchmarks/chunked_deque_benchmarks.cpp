@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include "chunked_deque.hpp"
+#include "vector.hpp"
+
+namespace {
+
+void BM_VectorInsertFront(benchmark::State &state) {
+  for (auto _ : state) {
+    vector::Vector<int> values;
+    for (int i = 0; i < state.range(0); ++i) {
+      values.insert(values.begin(), i);
+    }
+    benchmark::DoNotOptimize(values);
+  }
+}
+BENCHMARK(BM_VectorInsertFront)->Range(1 << 8, 1 << 14);
+
+void BM_DequePushFront(benchmark::State &state) {
+  for (auto _ : state) {
+    chunked_deque::ChunkedDeque<int> values;
+    for (int i = 0; i < state.range(0); ++i) {
+      values.push_front(i);
+    }
+    benchmark::DoNotOptimize(values);
+  }
+}
+BENCHMARK(BM_DequePushFront)->Range(1 << 8, 1 << 20);
+
+// Очередь с постоянной глубиной range(0): каждая итерация кладёт элемент в
+// конец и забирает из начала
+void BM_VectorQueue(benchmark::State &state) {
+  vector::Vector<int> queue;
+  for (int i = 0; i < state.range(0); ++i) {
+    queue.push_back(i);
+  }
+  int next = 0;
+  for (auto _ : state) {
+    queue.push_back(next++);
+    benchmark::DoNotOptimize(queue[0]);
+    queue.erase(queue.begin());
+  }
+}
+BENCHMARK(BM_VectorQueue)->Range(1 << 8, 1 << 16);
+
+void BM_DequeQueue(benchmark::State &state) {
+  chunked_deque::ChunkedDeque<int> queue;
+  for (int i = 0; i < state.range(0); ++i) {
+    queue.push_back(i);
+  }
+  int next = 0;
+  for (auto _ : state) {
+    queue.push_back(next++);
+    benchmark::DoNotOptimize(queue.front());
+    queue.pop_front();
+  }
+}
+BENCHMARK(BM_DequeQueue)->Range(1 << 8, 1 << 16);
+
+void BM_VectorPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    vector::Vector<int> values;
+    for (int i = 0; i < state.range(0); ++i) {
+      values.push_back(i);
+    }
+    benchmark::DoNotOptimize(values);
+  }
+}
+BENCHMARK(BM_VectorPushBack)->Range(1 << 8, 1 << 20);
+
+void BM_DequePushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    chunked_deque::ChunkedDeque<int> values;
+    for (int i = 0; i < state.range(0); ++i) {
+      values.push_back(i);
+    }
+    benchmark::DoNotOptimize(values);
+  }
+}
+BENCHMARK(BM_DequePushBack)->Range(1 << 8, 1 << 20);
+
+void BM_DequeRandomAccess(benchmark::State &state) {
+  chunked_deque::ChunkedDeque<int> values;
+  for (int i = 0; i < state.range(0); ++i) {
+    values.push_back(i);
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+      sum += values[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_DequeRandomAccess)->Range(1 << 8, 1 << 20);
+
+} // namespace
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "file_io.hpp"
+
+namespace {
+
+// 1 ГБ вместо 1–50 ГБ из постановки: файл должен помещаться на диск и в
+// память тестовой машины. Повторные чтения идут из страничного кэша, кроме
+// варианта с O_DIRECT
+constexpr size_t kCount = size_t{1} << 27;
+
+const std::string &data_file() {
+  static const std::string path = [] {
+    const std::string name =
+        (std::filesystem::temp_directory_path() / "containers_file_io.bin")
+            .string();
+    vector::Vector<std::uint64_t> values;
+    values.resize_for_overwrite(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+      values[i] = i;
+    }
+    file_io::store_file(name, values);
+    return name;
+  }();
+  return path;
+}
+
+void BM_IfstreamPushBack(benchmark::State &state) {
+  const std::string &path = data_file();
+  for (auto _ : state) {
+    std::ifstream in(path, std::ios::binary);
+    vector::Vector<std::uint64_t> values;
+    std::uint64_t value;
+    while (in.read(reinterpret_cast<char *>(&value), sizeof(value))) {
+      values.push_back(value);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_IfstreamPushBack)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void BM_IfstreamBulk(benchmark::State &state) {
+  const std::string &path = data_file();
+  for (auto _ : state) {
+    std::ifstream in(path, std::ios::binary);
+    vector::Vector<std::uint64_t> values;
+    values.resize_for_overwrite(kCount);
+    in.read(reinterpret_cast<char *>(values.data()),
+            kCount * sizeof(std::uint64_t));
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_IfstreamBulk)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Аргументы — глубина очереди и O_DIRECT
+void BM_LoadFile(benchmark::State &state) {
+  const std::string &path = data_file();
+  file_io::Options options;
+  options.queue_depth = state.range(0);
+  options.direct = state.range(1) != 0;
+  for (auto _ : state) {
+    auto values =
+        file_io::load_file<std::uint64_t, file_io::kDirectAlignment>(path,
+                                                                     options);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_LoadFile)
+    ->Args({1, 0})
+    ->Args({4, 0})
+    ->Args({1, 1})
+    ->Args({4, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_OfstreamWrite(benchmark::State &state) {
+  const std::string &path = data_file();
+  const auto values = file_io::load_file<std::uint64_t>(path);
+  const std::string copy = path + ".copy";
+  for (auto _ : state) {
+    std::ofstream out(copy, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(values.data()),
+              values.size() * sizeof(std::uint64_t));
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(std::uint64_t));
+  std::filesystem::remove(copy);
+}
+BENCHMARK(BM_OfstreamWrite)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void BM_StoreFile(benchmark::State &state) {
+  const std::string &path = data_file();
+  const auto values =
+      file_io::load_file<std::uint64_t, file_io::kDirectAlignment>(path);
+  const std::string copy = path + ".copy";
+  file_io::Options options;
+  options.queue_depth = state.range(0);
+  options.direct = state.range(1) != 0;
+  for (auto _ : state) {
+    file_io::store_file(copy, values, options);
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(std::uint64_t));
+  std::filesystem::remove(copy);
+}
+BENCHMARK(BM_StoreFile)
+    ->Args({4, 0})
+    ->Args({4, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace
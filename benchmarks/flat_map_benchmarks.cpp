@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "flat_map.hpp"
+
+namespace {
+
+std::vector<std::pair<int, int>> random_pairs(size_t count) {
+  std::mt19937 random(42);
+  std::vector<std::pair<int, int>> pairs(count);
+  for (size_t i = 0; i < count; ++i) {
+    pairs[i] = {static_cast<int>(random()), static_cast<int>(i)};
+  }
+  return pairs;
+}
+
+void BM_StdMapBuild(benchmark::State &state) {
+  const auto pairs = random_pairs(state.range(0));
+  for (auto _ : state) {
+    std::map<int, int> map(pairs.begin(), pairs.end());
+    benchmark::DoNotOptimize(map);
+  }
+}
+BENCHMARK(BM_StdMapBuild)->RangeMultiplier(10)->Range(1000, 1000000);
+
+void BM_FlatMapBuild(benchmark::State &state) {
+  const auto pairs = random_pairs(state.range(0));
+  for (auto _ : state) {
+    flat_map::FlatMap<int, int> map(pairs.begin(), pairs.end());
+    benchmark::DoNotOptimize(map);
+  }
+}
+BENCHMARK(BM_FlatMapBuild)->RangeMultiplier(10)->Range(1000, 1000000);
+
+void BM_StdMapFind(benchmark::State &state) {
+  const auto pairs = random_pairs(state.range(0));
+  std::map<int, int> map(pairs.begin(), pairs.end());
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(pairs[next].first));
+    next = next + 1 == pairs.size() ? 0 : next + 1;
+  }
+}
+BENCHMARK(BM_StdMapFind)->RangeMultiplier(10)->Range(1000, 1000000);
+
+void BM_FlatMapFind(benchmark::State &state) {
+  const auto pairs = random_pairs(state.range(0));
+  flat_map::FlatMap<int, int> map(pairs.begin(), pairs.end());
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(pairs[next].first));
+    next = next + 1 == pairs.size() ? 0 : next + 1;
+  }
+}
+BENCHMARK(BM_FlatMapFind)->RangeMultiplier(10)->Range(1000, 1000000);
+
+// Вставка пакета из 1% новых ключей в заполненный словарь
+void BM_StdMapBatchInsert(benchmark::State &state) {
+  const auto pairs = random_pairs(state.range(0));
+  const auto batch = random_pairs(state.range(0) / 100 + 1);
+  const std::map<int, int> base(pairs.begin(), pairs.end());
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::map<int, int> map = base;
+    state.ResumeTiming();
+    map.insert(batch.begin(), batch.end());
+    benchmark::DoNotOptimize(map);
+  }
+}
+BENCHMARK(BM_StdMapBatchInsert)->RangeMultiplier(10)->Range(1000, 1000000);
+
+void BM_FlatMapBatchInsert(benchmark::State &state) {
+  const auto pairs = random_pairs(state.range(0));
+  const auto batch = random_pairs(state.range(0) / 100 + 1);
+  const flat_map::FlatMap<int, int> base(pairs.begin(), pairs.end());
+  for (auto _ : state) {
+    state.PauseTiming();
+    flat_map::FlatMap<int, int> map = base;
+    state.ResumeTiming();
+    map.insert(batch.begin(), batch.end());
+    benchmark::DoNotOptimize(map);
+  }
+}
+BENCHMARK(BM_FlatMapBatchInsert)->RangeMultiplier(10)->Range(1000, 1000000);
+
+} // namespace
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "gap_buffer.hpp"
+#include "vector.hpp"
+
+namespace {
+
+constexpr int kEditsPerIteration = 64;
+
+// Набор текста: вставки подряд в одну точку в середине буфера
+void BM_VectorTyping(benchmark::State &state) {
+  vector::Vector<char> text(state.range(0));
+  size_t cursor = text.size() / 2;
+  for (auto _ : state) {
+    for (int i = 0; i < kEditsPerIteration; ++i) {
+      text.insert(text.begin() + cursor++, 'x');
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_VectorTyping)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_GapBufferTyping(benchmark::State &state) {
+  gap_buffer::GapBuffer<char> text(state.range(0));
+  size_t cursor = text.size() / 2;
+  for (auto _ : state) {
+    for (int i = 0; i < kEditsPerIteration; ++i) {
+      text.insert(text.begin() + cursor++, 'x');
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_GapBufferTyping)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Удаление символов перед курсором (backspace)
+void BM_VectorBackspace(benchmark::State &state) {
+  vector::Vector<char> text(state.range(0));
+  size_t cursor = text.size() / 2;
+  for (auto _ : state) {
+    for (int i = 0; i < kEditsPerIteration; ++i) {
+      text.erase(text.begin() + --cursor);
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_VectorBackspace)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_GapBufferBackspace(benchmark::State &state) {
+  gap_buffer::GapBuffer<char> text(state.range(0));
+  size_t cursor = text.size() / 2;
+  for (auto _ : state) {
+    for (int i = 0; i < kEditsPerIteration; ++i) {
+      text.erase(text.begin() + --cursor);
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_GapBufferBackspace)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Короткие правки вокруг курсора, который время от времени прыгает на
+// расстояние до 64 КБ
+void BM_GapBufferLocalJumps(benchmark::State &state) {
+  gap_buffer::GapBuffer<char> text(state.range(0));
+  std::mt19937 random(42);
+  std::uniform_int_distribution<long> jump(-(1 << 16), 1 << 16);
+  long cursor = state.range(0) / 2;
+  for (auto _ : state) {
+    cursor = std::clamp<long>(cursor + jump(random), 0,
+                              static_cast<long>(text.size()));
+    for (int i = 0; i < kEditsPerIteration; ++i) {
+      text.insert(text.begin() + cursor++, 'x');
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_GapBufferLocalJumps)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_VectorLocalJumps(benchmark::State &state) {
+  vector::Vector<char> text(state.range(0));
+  std::mt19937 random(42);
+  std::uniform_int_distribution<long> jump(-(1 << 16), 1 << 16);
+  long cursor = state.range(0) / 2;
+  for (auto _ : state) {
+    cursor = std::clamp<long>(cursor + jump(random), 0,
+                              static_cast<long>(text.size()));
+    for (int i = 0; i < kEditsPerIteration; ++i) {
+      text.insert(text.begin() + cursor++, 'x');
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_VectorLocalJumps)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Последовательное чтение всего буфера через итераторы
+void BM_GapBufferScan(benchmark::State &state) {
+  gap_buffer::GapBuffer<char> text(state.range(0));
+  text.move_gap(text.size() / 2);
+  for (auto _ : state) {
+    long sum = 0;
+    for (char c : text) {
+      sum += c;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GapBufferScan)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hash_map.hpp"
+
+namespace {
+
+std::vector<uint64_t> random_integers(size_t count) {
+  std::mt19937_64 random(42);
+  std::vector<uint64_t> keys(count);
+  for (auto &key : keys) {
+    key = random();
+  }
+  return keys;
+}
+
+std::vector<std::string> random_strings(size_t count) {
+  std::vector<std::string> keys;
+  keys.reserve(count);
+  for (uint64_t key : random_integers(count)) {
+    keys.push_back("key_" + std::to_string(key));
+  }
+  return keys;
+}
+
+template <typename Map, typename Key>
+void insert_all(Map &map, const std::vector<Key> &keys) {
+  map.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    map[keys[i]] = i;
+  }
+}
+
+template <typename Map> void BM_InsertIntegers(benchmark::State &state) {
+  const auto keys = random_integers(state.range(0));
+  for (auto _ : state) {
+    Map map;
+    insert_all(map, keys);
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_InsertIntegers, std::unordered_map<uint64_t, size_t>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_InsertIntegers, hash_map::HashMap<uint64_t, size_t>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <typename Map> void BM_FindIntegers(benchmark::State &state) {
+  const auto keys = random_integers(state.range(0));
+  const auto misses = random_integers(state.range(0) * 2);
+  Map map;
+  insert_all(map, keys);
+  size_t next = 0;
+  for (auto _ : state) {
+    // Чередуем попадания и промахи
+    benchmark::DoNotOptimize(map.find(keys[next]));
+    benchmark::DoNotOptimize(map.find(misses[misses.size() - 1 - next]));
+    next = next + 1 == keys.size() ? 0 : next + 1;
+  }
+}
+BENCHMARK_TEMPLATE(BM_FindIntegers, std::unordered_map<uint64_t, size_t>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000);
+BENCHMARK_TEMPLATE(BM_FindIntegers, hash_map::HashMap<uint64_t, size_t>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000);
+
+template <typename Map> void BM_EraseIntegers(benchmark::State &state) {
+  const auto keys = random_integers(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Map map;
+    insert_all(map, keys);
+    state.ResumeTiming();
+    for (uint64_t key : keys) {
+      map.erase(key);
+    }
+    benchmark::DoNotOptimize(map);
+  }
+}
+BENCHMARK_TEMPLATE(BM_EraseIntegers, std::unordered_map<uint64_t, size_t>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_EraseIntegers, hash_map::HashMap<uint64_t, size_t>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <typename Map> void BM_InsertStrings(benchmark::State &state) {
+  const auto keys = random_strings(state.range(0));
+  for (auto _ : state) {
+    Map map;
+    insert_all(map, keys);
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_InsertStrings, std::unordered_map<std::string, size_t>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_InsertStrings,
+                   hash_map::HashMap<std::string, size_t, hash_map::StringHash,
+                                     hash_map::StringEqual>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <typename Map> void BM_FindStrings(benchmark::State &state) {
+  const auto keys = random_strings(state.range(0));
+  Map map;
+  insert_all(map, keys);
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(keys[next]));
+    next = next + 1 == keys.size() ? 0 : next + 1;
+  }
+}
+BENCHMARK_TEMPLATE(BM_FindStrings, std::unordered_map<std::string, size_t>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000);
+BENCHMARK_TEMPLATE(BM_FindStrings,
+                   hash_map::HashMap<std::string, size_t, hash_map::StringHash,
+                                     hash_map::StringEqual>)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000);
+
+} // namespace
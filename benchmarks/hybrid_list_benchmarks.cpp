@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include "hybrid_list.hpp"
+#include "single_linked_list.hpp"
+
+namespace {
+
+// Типичный короткоживущий список: заполнить range(0) элементами,
+// просуммировать, выбросить
+template <typename List> long long fill_and_sum(int count) {
+  List list;
+  for (int i = 0; i < count; ++i) {
+    list.push_back(i);
+  }
+  long long sum = 0;
+  for (long long value : list) {
+    sum += value;
+  }
+  return sum;
+}
+
+template <typename List> void BM_FillAndSum(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(fill_and_sum<List>(state.range(0)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Обход уже заполненного списка
+template <typename List> void BM_Traverse(benchmark::State &state) {
+  List list;
+  for (int i = 0; i < state.range(0); ++i) {
+    list.push_back(i);
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (long long value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using Single = single_linked_list::SingleLinkedList<long long>;
+using Hybrid = hybrid_list::HybridList<long long>;
+
+void sizes(benchmark::internal::Benchmark *benchmark) {
+  for (int size : {1, 8, 32, 33, 1000, 1000000}) {
+    benchmark->Arg(size);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_FillAndSum, Single)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_FillAndSum, Hybrid)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Traverse, Single)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Traverse, Hybrid)->Apply(sizes);
+
+} // namespace
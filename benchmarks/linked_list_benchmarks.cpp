@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "double_linked_list.hpp"
+#include "single_linked_list.hpp"
+
+namespace {
+
+using List = single_linked_list::SingleLinkedList<long long>;
+
+// Список длиной count. При shuffled перед заполнением куча дробится:
+// блоки размера узла освобождаются в случайном порядке, и аллокатор
+// выдаёт их узлам вразнобой. Иначе освобождённые ранее блоки сначала
+// сливаются, чтобы узлы легли в память подряд
+template <typename Container>
+void fill(Container &list, int count, bool shuffled,
+          size_t node_size = sizeof(long long) + sizeof(void *)) {
+#if defined(__GLIBC__)
+  malloc_trim(0);
+#endif
+  std::vector<void *> blocks;
+  if (shuffled) {
+    blocks.resize(count);
+    for (void *&block : blocks) {
+      block = std::malloc(node_size);
+    }
+    std::shuffle(blocks.begin(), blocks.end(), std::mt19937(42));
+    for (void *block : blocks) {
+      std::free(block);
+    }
+  }
+  for (int i = 0; i < count; ++i) {
+    list.push_back(i);
+  }
+}
+
+void BM_IteratorSum(benchmark::State &state) {
+  List list;
+  fill(list, state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0ll));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IteratorSum)->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+void BM_PrefetchSum(benchmark::State &state) {
+  List list;
+  fill(list, state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(list.transform_reduce(
+        0ll, std::plus<>(), [](long long value) { return value; }));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PrefetchSum)->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+// Четыре списка по range(0) / 4 элементов: подряд и вперемешку
+void BM_SequentialLists(benchmark::State &state) {
+  List lists[4];
+  for (List &list : lists) {
+    fill(list, state.range(0) / 4, state.range(1));
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (List &list : lists) {
+      list.for_each([&sum](long long value) { sum += value; });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SequentialLists)->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+void BM_InterleavedLists(benchmark::State &state) {
+  List lists[4];
+  for (List &list : lists) {
+    fill(list, state.range(0) / 4, state.range(1));
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    List::for_each_interleaved(
+        [&sum](size_t, long long value) { sum += value; }, lists[0], lists[1],
+        lists[2], lists[3]);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InterleavedLists)->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+// Копирование списка из range(0) элементов вместе с освобождением копии
+void BM_SingleListCopy(benchmark::State &state) {
+  List list;
+  fill(list, state.range(0), false);
+  for (auto _ : state) {
+    List copy(list);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SingleListCopy)->Arg(1000)->Arg(1000000)->Unit(
+    benchmark::kMillisecond);
+
+// Обход двусвязного списка с узлами вразнобой до и после compact()
+void BM_DoubleListTraversal(benchmark::State &state) {
+  double_linked_list::DoubleLinkedList<long long> list;
+  fill(list, state.range(0), true,
+       sizeof(long long) + 2 * sizeof(void *) + sizeof(bool));
+  if (state.range(1)) {
+    list.compact();
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0ll));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DoubleListTraversal)
+    ->Args({1 << 20, 0})
+    ->Args({1 << 20, 1})
+    ->Args({10000000, 0})
+    ->Args({10000000, 1})
+    ->Unit(benchmark::kMillisecond);
+
+// Цена уплотнения и длина одной паузы при шаге в range(1) узлов
+void BM_DoubleListCompactStep(benchmark::State &state) {
+  double_linked_list::DoubleLinkedList<long long> list;
+  fill(list, state.range(0), true,
+       sizeof(long long) + 2 * sizeof(void *) + sizeof(bool));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(list.compact_step(state.range(1)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_DoubleListCompactStep)
+    ->Args({1 << 20, 1 << 10})
+    ->Args({1 << 20, 1 << 14})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+
+#include "parallel.hpp"
+#include "vector.hpp"
+
+namespace {
+
+constexpr size_t kSize = 1 << 24;
+
+vector::Vector<unsigned> random_values(size_t size) {
+  vector::Vector<unsigned> values(size);
+  std::mt19937 random(42);
+  for (unsigned &value : values) {
+    value = random();
+  }
+  return values;
+}
+
+// Аргумент — число потоков: от 1 до всех ядер машины
+void thread_counts(benchmark::internal::Benchmark *benchmark) {
+  const int cores = std::max(1u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads < cores; threads *= 2) {
+    benchmark->Arg(threads);
+  }
+  benchmark->Arg(cores);
+}
+
+void BM_ParallelSort(benchmark::State &state) {
+  parallel::ThreadPool pool(state.range(0));
+  const auto source = random_values(kSize);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = source;
+    state.ResumeTiming();
+    parallel::sort(pool, values.begin(), values.end());
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ParallelSort)
+    ->Apply(thread_counts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_ParallelReduce(benchmark::State &state) {
+  parallel::ThreadPool pool(state.range(0));
+  const auto values = random_values(kSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        parallel::reduce(pool, values.begin(), values.end(), 0ull));
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ParallelReduce)
+    ->Apply(thread_counts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_ParallelTransform(benchmark::State &state) {
+  parallel::ThreadPool pool(state.range(0));
+  const auto values = random_values(kSize);
+  vector::Vector<unsigned> result(kSize);
+  for (auto _ : state) {
+    parallel::transform(pool, values.begin(), values.end(), result.begin(),
+                        [](unsigned value) { return value * 2654435761u; });
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ParallelTransform)
+    ->Apply(thread_counts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_ParallelScan(benchmark::State &state) {
+  parallel::ThreadPool pool(state.range(0));
+  const auto values = random_values(kSize);
+  vector::Vector<unsigned> result(kSize);
+  for (auto _ : state) {
+    parallel::inclusive_scan(pool, values.begin(), values.end(),
+                             result.begin());
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ParallelScan)
+    ->Apply(thread_counts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_ParallelPartition(benchmark::State &state) {
+  parallel::ThreadPool pool(state.range(0));
+  const auto source = random_values(kSize);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = source;
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(parallel::partition(
+        pool, values.begin(), values.end(),
+        [](unsigned value) { return value % 2 == 0; }));
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_ParallelPartition)
+    ->Apply(thread_counts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Точка отсчёта — последовательная сортировка стандартной библиотеки
+void BM_StdSort(benchmark::State &state) {
+  const auto source = random_values(kSize);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = source;
+    state.ResumeTiming();
+    std::sort(values.begin(), values.end());
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_StdSort)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include "persistent_list.hpp"
+#include "single_linked_list.hpp"
+
+namespace {
+
+// История версий: каждая правка сохраняет предыдущее состояние списка
+// длиной range(0)
+void BM_SingleLinkedListHistory(benchmark::State &state) {
+  single_linked_list::SingleLinkedList<int> current;
+  for (int i = 0; i < state.range(0); ++i) {
+    current.push_front(i);
+  }
+  for (auto _ : state) {
+    single_linked_list::SingleLinkedList<int> version(current);
+    version.push_front(-1);
+    benchmark::DoNotOptimize(version);
+  }
+}
+BENCHMARK(BM_SingleLinkedListHistory)->Range(1 << 6, 1 << 14);
+
+void BM_PersistentListHistory(benchmark::State &state) {
+  persistent_list::PersistentList<int> current;
+  for (int i = 0; i < state.range(0); ++i) {
+    current = current.push_front(i);
+  }
+  for (auto _ : state) {
+    auto version = current.push_front(-1);
+    benchmark::DoNotOptimize(version);
+  }
+}
+BENCHMARK(BM_PersistentListHistory)->Range(1 << 6, 1 << 14);
+
+} // namespace
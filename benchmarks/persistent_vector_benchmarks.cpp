@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include "persistent_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+// Новая версия с одним изменённым элементом при сохранении старой
+void BM_VectorCopySet(benchmark::State &state) {
+  vector::Vector<int> current(state.range(0));
+  size_t index = 0;
+  for (auto _ : state) {
+    vector::Vector<int> version(current);
+    version[index] = 1;
+    index = (index + 7919) % current.size();
+    benchmark::DoNotOptimize(version.data());
+  }
+}
+BENCHMARK(BM_VectorCopySet)->Range(1 << 8, 1 << 18);
+
+void BM_PersistentVectorSet(benchmark::State &state) {
+  auto batch = persistent_vector::PersistentVector<int>().transient();
+  for (int i = 0; i < state.range(0); ++i) {
+    batch.push_back(0);
+  }
+  const auto current = std::move(batch).persistent();
+  size_t index = 0;
+  for (auto _ : state) {
+    auto version = current.set(index, 1);
+    index = (index + 7919) % current.size();
+    benchmark::DoNotOptimize(version);
+  }
+}
+BENCHMARK(BM_PersistentVectorSet)->Range(1 << 8, 1 << 18);
+
+// Построение: по версии на элемент и пакетно через Transient
+void BM_PersistentVectorPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    persistent_vector::PersistentVector<int> values;
+    for (int i = 0; i < state.range(0); ++i) {
+      values = values.push_back(i);
+    }
+    benchmark::DoNotOptimize(values);
+  }
+}
+BENCHMARK(BM_PersistentVectorPushBack)->Arg(1 << 14);
+
+void BM_TransientPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    auto batch = persistent_vector::PersistentVector<int>().transient();
+    for (int i = 0; i < state.range(0); ++i) {
+      batch.push_back(i);
+    }
+    benchmark::DoNotOptimize(std::move(batch).persistent());
+  }
+}
+BENCHMARK(BM_TransientPushBack)->Arg(1 << 14);
+
+} // namespace
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+
+#include "radix_sort.hpp"
+
+namespace {
+
+struct Record {
+  std::uint64_t key;
+  std::uint64_t payload;
+};
+
+template <typename T> vector::Vector<T> random_values(size_t size) {
+  vector::Vector<T> values(size);
+  std::mt19937_64 random(42);
+  for (T &value : values) {
+    if constexpr (std::is_same_v<T, float>) {
+      value = std::uniform_real_distribution<float>(-1e6f, 1e6f)(random);
+    } else if constexpr (std::is_same_v<T, Record>) {
+      value = Record{random(), random()};
+    } else {
+      value = static_cast<T>(random());
+    }
+  }
+  return values;
+}
+
+std::uint64_t key_of(const Record &record) { return record.key; }
+
+// Размеры от 10^6 до 10^8: 10^9 ключей вместе с буфером не помещаются в
+// память тестовой машины
+void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->Arg(1000000)->Arg(10000000)->Arg(100000000);
+}
+
+template <typename T> void BM_StdSort(benchmark::State &state) {
+  const auto source = random_values<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = source;
+    state.ResumeTiming();
+    if constexpr (std::is_same_v<T, Record>) {
+      std::sort(values.begin(), values.end(),
+                [](const Record &lhs, const Record &rhs) {
+                  return lhs.key < rhs.key;
+                });
+    } else {
+      std::sort(values.begin(), values.end());
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StdSort, std::uint32_t)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSort, std::uint64_t)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSort, float)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSort, Record)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+
+template <typename T> void BM_RadixSort(benchmark::State &state) {
+  const auto source = random_values<T>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = source;
+    state.ResumeTiming();
+    if constexpr (std::is_same_v<T, Record>) {
+      radix_sort::sort_by_key(values, key_of);
+    } else {
+      radix_sort::sort(values);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RadixSort, std::uint32_t)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RadixSort, std::uint64_t)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RadixSort, float)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RadixSort, Record)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_ParallelRadixSort(benchmark::State &state) {
+  parallel::ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+  const auto source = random_values<std::uint32_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = source;
+    state.ResumeTiming();
+    radix_sort::sort(pool, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelRadixSort)
+    ->Apply(sizes)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <ranges>
+
+#include "single_linked_list.hpp"
+#include "vector.hpp"
+
+namespace {
+
+constexpr size_t kSize = 1 << 20;
+
+vector::Vector<int> random_values() {
+  vector::Vector<int> values(kSize);
+  std::mt19937 random(42);
+  for (int &value : values) {
+    value = static_cast<int>(random() % 1000);
+  }
+  return values;
+}
+
+bool is_even(int value) { return value % 2 == 0; }
+long long square(int value) { return 1ll * value * value; }
+
+// filter → transform → take с промежуточными Vector на каждом шаге
+template <typename Range>
+long long materialized(const Range &source, size_t count,
+                       benchmark::State &state) {
+  vector::Vector<int> filtered;
+  for (int value : source) {
+    if (is_even(value)) {
+      filtered.push_back(value);
+    }
+  }
+  vector::Vector<long long> transformed;
+  for (int value : filtered) {
+    transformed.push_back(square(value));
+  }
+  vector::Vector<long long> taken;
+  for (size_t i = 0; i < count && i < transformed.size(); ++i) {
+    taken.push_back(transformed[i]);
+  }
+  state.counters["intermediate_bytes"] =
+      filtered.size() * sizeof(int) +
+      (transformed.size() + taken.size()) * sizeof(long long);
+  long long sum = 0;
+  for (long long value : taken) {
+    sum += value;
+  }
+  return sum;
+}
+
+// Та же цепочка лениво: элементы вычисляются по одному при обходе
+template <typename Range> long long lazy(const Range &source, size_t count) {
+  long long sum = 0;
+  for (long long value : source | std::views::filter(is_even) |
+                             std::views::transform(square) |
+                             std::views::take(count)) {
+    sum += value;
+  }
+  return sum;
+}
+
+// Аргумент — сколько элементов забирает take
+void BM_VectorMaterialized(benchmark::State &state) {
+  const auto source = random_values();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(materialized(source, state.range(0), state));
+  }
+}
+BENCHMARK(BM_VectorMaterialized)->Arg(1000)->Arg(kSize);
+
+void BM_VectorLazy(benchmark::State &state) {
+  const auto source = random_values();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lazy(source, state.range(0)));
+  }
+}
+BENCHMARK(BM_VectorLazy)->Arg(1000)->Arg(kSize);
+
+single_linked_list::SingleLinkedList<int> random_list() {
+  const auto values = random_values();
+  single_linked_list::SingleLinkedList<int> list;
+  for (size_t i = values.size(); i > 0; --i) {
+    list.push_front(values[i - 1]);
+  }
+  return list;
+}
+
+void BM_ListMaterialized(benchmark::State &state) {
+  const auto source = random_list();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(materialized(source, state.range(0), state));
+  }
+}
+BENCHMARK(BM_ListMaterialized)->Arg(1000)->Arg(kSize);
+
+void BM_ListLazy(benchmark::State &state) {
+  const auto source = random_list();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lazy(source, state.range(0)));
+  }
+}
+BENCHMARK(BM_ListLazy)->Arg(1000)->Arg(kSize);
+
+} // namespace
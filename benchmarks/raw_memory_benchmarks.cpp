@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "vector.hpp"
+
+namespace {
+
+// Размер рабочего набора в МБ; для замеров на больших машинах его стоит
+// поднять до 16 ГБ и выше, где промахи TLB становятся заметнее
+constexpr size_t kWorkingSetMb = 1024;
+
+// Случайные обращения к большому буферу: на обычных 4 КБ страницах почти
+// каждое обращение промахивается мимо TLB, на 2 МБ страницах — значительно
+// реже. Аргумент — порог huge pages: 0 включает их, INT64_MAX выключает
+void BM_RandomAccess(benchmark::State &state) {
+  const size_t old_threshold = vector::huge_page_threshold();
+  vector::set_huge_page_threshold(static_cast<size_t>(state.range(0)));
+  const size_t count = kWorkingSetMb * 1024 * 1024 / sizeof(std::uint64_t);
+  vector::Vector<std::uint64_t> data;
+  data.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    data[i] = i;
+  }
+  std::uint64_t state_rng = 88172645463325252ull;
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (int i = 0; i < 1 << 16; ++i) {
+      state_rng ^= state_rng << 13;
+      state_rng ^= state_rng >> 7;
+      state_rng ^= state_rng << 17;
+      sum += data[state_rng % count];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * (1 << 16));
+  vector::set_huge_page_threshold(old_threshold);
+}
+BENCHMARK(BM_RandomAccess)
+    ->Arg(0)
+    ->Arg(static_cast<int64_t>(INT64_MAX))
+    ->Unit(benchmark::kMicrosecond);
+
+// Параллельный просмотр: каждый поток читает свою часть вектора, разбитую
+// так же, как при FirstTouch. Аргумент — NumaPlacement; на машине с одним
+// узлом все варианты совпадают с обычным выделением
+void BM_NumaScan(benchmark::State &state) {
+  vector::NumaPolicy policy;
+  policy.placement = static_cast<vector::NumaPlacement>(state.range(0));
+  const size_t threads =
+      std::max(2u, std::thread::hardware_concurrency());
+  policy.threads = threads;
+  const size_t count = 256 * 1024 * 1024 / sizeof(std::uint64_t);
+  vector::Vector<std::uint64_t> data(count, policy);
+  vector::Vector<std::uint64_t> sums(threads);
+  for (auto _ : state) {
+    vector::Vector<std::thread> workers;
+    for (size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([&data, &sums, threads, count, i] {
+        const size_t first = vector::numa_partition_begin(count, threads, i);
+        const size_t last = vector::numa_partition_begin(count, threads, i + 1);
+        std::uint64_t sum = 0;
+        for (size_t j = first; j < last; ++j) {
+          sum += data[j];
+        }
+        sums[i] = sum;
+      });
+    }
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+    benchmark::DoNotOptimize(sums.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_NumaScan)
+    ->Arg(static_cast<int>(vector::NumaPlacement::Local))
+    ->Arg(static_cast<int>(vector::NumaPlacement::Interleave))
+    ->Arg(static_cast<int>(vector::NumaPlacement::FirstTouch))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include "shared_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+// Писатель дописывает элементы и каждые 64 вставки отдаёт снимок читателю,
+// который читает из него один элемент
+template <typename Container> void append_with_snapshots(int count) {
+  Container values;
+  long long sum = 0;
+  for (int i = 0; i < count; ++i) {
+    values.push_back(i);
+    if (i % 64 == 0) {
+      Container snapshot(values);
+      sum += snapshot[snapshot.size() / 2];
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+}
+
+void BM_VectorSnapshots(benchmark::State &state) {
+  for (auto _ : state) {
+    append_with_snapshots<vector::Vector<int>>(state.range(0));
+  }
+}
+BENCHMARK(BM_VectorSnapshots)->Range(1 << 10, 1 << 16);
+
+void BM_SharedVectorSnapshots(benchmark::State &state) {
+  for (auto _ : state) {
+    append_with_snapshots<shared_vector::SharedVector<int>>(state.range(0));
+  }
+}
+BENCHMARK(BM_SharedVectorSnapshots)->Range(1 << 10, 1 << 16);
+
+// Последовательное чтение: цена двойной адресации через таблицу блоков
+template <typename Container> void BM_Scan(benchmark::State &state) {
+  Container values;
+  for (int i = 0; i < state.range(0); ++i) {
+    values.push_back(i);
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (int value : values) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK_TEMPLATE(BM_Scan, vector::Vector<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Scan, shared_vector::SharedVector<int>)->Arg(1 << 16);
+
+} // namespace
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "soa_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+// 40-байтная запись: типичный агрегат, из которого сканируются 1-2 поля
+struct Record {
+  double price;
+  double quantity;
+  int64_t id;
+  int64_t timestamp;
+  int32_t flags;
+  int32_t venue;
+};
+static_assert(sizeof(Record) == 40);
+
+using RecordColumns =
+    soa_vector::SoaVector<double, double, int64_t, int64_t, int32_t, int32_t>;
+
+vector::Vector<Record> make_aos(size_t n) {
+  vector::Vector<Record> records;
+  for (size_t i = 0; i < n; ++i) {
+    records.push_back(Record{i * 0.25, i * 0.5, static_cast<int64_t>(i),
+                             static_cast<int64_t>(i * 7), 0, 1});
+  }
+  return records;
+}
+
+RecordColumns make_soa(size_t n) {
+  RecordColumns records;
+  records.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    records.push_back(i * 0.25, i * 0.5, static_cast<int64_t>(i),
+                      static_cast<int64_t>(i * 7), 0, 1);
+  }
+  return records;
+}
+
+void BM_AosScanOneField(benchmark::State &state) {
+  const auto records = make_aos(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    for (const Record &record : records) {
+      sum += record.price;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(Record));
+}
+BENCHMARK(BM_AosScanOneField)->Range(1 << 10, 1 << 22);
+
+void BM_SoaScanOneField(benchmark::State &state) {
+  const auto records = make_soa(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    for (double price : records.column<0>()) {
+      sum += price;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(double));
+}
+BENCHMARK(BM_SoaScanOneField)->Range(1 << 10, 1 << 22);
+
+void BM_AosScanTwoFields(benchmark::State &state) {
+  const auto records = make_aos(state.range(0));
+  for (auto _ : state) {
+    double notional = 0;
+    for (const Record &record : records) {
+      notional += record.price * record.quantity;
+    }
+    benchmark::DoNotOptimize(notional);
+  }
+}
+BENCHMARK(BM_AosScanTwoFields)->Range(1 << 10, 1 << 22);
+
+void BM_SoaScanTwoFields(benchmark::State &state) {
+  const auto records = make_soa(state.range(0));
+  for (auto _ : state) {
+    const auto prices = records.column<0>();
+    const auto quantities = records.column<1>();
+    double notional = 0;
+    for (size_t i = 0; i < prices.size(); ++i) {
+      notional += prices[i] * quantities[i];
+    }
+    benchmark::DoNotOptimize(notional);
+  }
+}
+BENCHMARK(BM_SoaScanTwoFields)->Range(1 << 10, 1 << 22);
+
+void BM_AosPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_aos(state.range(0)));
+  }
+}
+BENCHMARK(BM_AosPushBack)->Range(1 << 10, 1 << 20);
+
+void BM_SoaPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    RecordColumns records;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      records.push_back(i * 0.25, i * 0.5, i, i * 7, 0, 1);
+    }
+    benchmark::DoNotOptimize(records);
+  }
+}
+BENCHMARK(BM_SoaPushBack)->Range(1 << 10, 1 << 20);
+
+} // namespace
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include "static_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+// Короткий рабочий буфер в горячем цикле: заполнить, просуммировать,
+// выбросить
+template <typename Scratch> long long fill_and_sum(int count) {
+  Scratch scratch;
+  for (int i = 0; i < count; ++i) {
+    scratch.push_back(i);
+  }
+  long long sum = 0;
+  for (int value : scratch) {
+    sum += value;
+  }
+  return sum;
+}
+
+void BM_VectorScratch(benchmark::State &state) {
+  for (auto _ : state) {
+    for (int i = 0; i < 1000; ++i) {
+      benchmark::DoNotOptimize(
+          fill_and_sum<vector::Vector<int>>(state.range(0)));
+    }
+  }
+}
+BENCHMARK(BM_VectorScratch)->Arg(4)->Arg(16)->Arg(64);
+
+void BM_StaticVectorScratch(benchmark::State &state) {
+  for (auto _ : state) {
+    for (int i = 0; i < 1000; ++i) {
+      benchmark::DoNotOptimize(
+          fill_and_sum<static_vector::StaticVector<int, 64>>(state.range(0)));
+    }
+  }
+}
+BENCHMARK(BM_StaticVectorScratch)->Arg(4)->Arg(16)->Arg(64);
+
+void BM_StaticVectorCheckedScratch(benchmark::State &state) {
+  using Scratch =
+      static_vector::StaticVector<int, 64, static_vector::CheckedOverflow>;
+  for (auto _ : state) {
+    for (int i = 0; i < 1000; ++i) {
+      benchmark::DoNotOptimize(fill_and_sum<Scratch>(state.range(0)));
+    }
+  }
+}
+BENCHMARK(BM_StaticVectorCheckedScratch)->Arg(4)->Arg(16)->Arg(64);
+
+} // namespace
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include "single_linked_list.hpp"
+#include "telemetry.hpp"
+#include "vector.hpp"
+
+// Собирается дважды: containers_telemetry_benchmarks_off без телеметрии и
+// _on с CONTAINERS_TELEMETRY=1. Аргумент — установлен ли Recorder
+
+namespace {
+
+struct HookGuard {
+  telemetry::Recorder recorder;
+  explicit HookGuard(bool enabled) {
+    telemetry::set_hook(enabled ? &recorder : nullptr);
+  }
+  ~HookGuard() { telemetry::set_hook(nullptr); }
+};
+
+void BM_VectorPushBack(benchmark::State &state) {
+  HookGuard guard(state.range(0) != 0);
+  for (auto _ : state) {
+    vector::Vector<int> values;
+    for (int i = 0; i < 1 << 16; ++i) {
+      values.push_back(i);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * (1 << 16));
+}
+BENCHMARK(BM_VectorPushBack)->Arg(0)->Arg(1);
+
+void BM_ListPushPop(benchmark::State &state) {
+  HookGuard guard(state.range(0) != 0);
+  single_linked_list::SingleLinkedList<int> list;
+  for (auto _ : state) {
+    for (int i = 0; i < 1024; ++i) {
+      list.push_front(i);
+    }
+    for (int i = 0; i < 1024; ++i) {
+      list.pop_front();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 2048);
+}
+BENCHMARK(BM_ListPushPop)->Arg(0)->Arg(1);
+
+} // namespace
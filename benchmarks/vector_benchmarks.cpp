@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "vector.hpp"
+
+namespace {
+
+// Небольшая тривиальная запись: копируется и переносится memcpy
+struct Point {
+  double x;
+  double y;
+  int id;
+};
+
+template <typename T> T make_value(int i) { return T{i}; }
+template <> Point make_value<Point>(int i) { return Point{1.0 * i, 2.0 * i, i}; }
+template <> std::string make_value<std::string>(int i) {
+  return std::string(24, static_cast<char>('a' + i % 26));
+}
+
+template <typename T> vector::Vector<T> make_vector(size_t size) {
+  vector::Vector<T> values;
+  values.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    values.push_back(make_value<T>(static_cast<int>(i)));
+  }
+  return values;
+}
+
+// Копирующее присваивание в вектор того же размера
+template <typename T> void BM_CopyAssign(benchmark::State &state) {
+  const auto source = make_vector<T>(state.range(0));
+  auto target = make_vector<T>(state.range(0));
+  for (auto _ : state) {
+    target = source;
+    benchmark::DoNotOptimize(target.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_CopyAssign, int)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_CopyAssign, Point)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_CopyAssign, std::string)->Arg(1 << 16);
+
+// Вставка и удаление в начале: сдвиг всего хвоста
+template <typename T> void BM_InsertEraseFront(benchmark::State &state) {
+  auto values = make_vector<T>(state.range(0));
+  const T value = make_value<T>(1);
+  for (auto _ : state) {
+    values.insert(values.begin(), value);
+    values.erase(values.begin());
+    benchmark::DoNotOptimize(values.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, int)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, Point)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, std::string)->Arg(1 << 14);
+
+// Рост без reserve: каждое перераспределение переносит все элементы
+template <typename T> void BM_PushBackGrowth(benchmark::State &state) {
+  const T value = make_value<T>(1);
+  for (auto _ : state) {
+    vector::Vector<T> values;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      values.push_back(value);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PushBackGrowth, int)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBackGrowth, Point)->Arg(1 << 16);
+
+// Вложенные векторы переносятся побайтово, без перемещения каждого
+void BM_NestedGrowth(benchmark::State &state) {
+  for (auto _ : state) {
+    vector::Vector<vector::Vector<int>> values;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      values.emplace_back();
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NestedGrowth)->Arg(1 << 16);
+
+} // namespace
@@ -0,0 +1,54 @@
+#pragma once
+#include <cassert>
+#include <stdexcept>
+
+// Режим проверки индексов в operator[], erase и insert контейнеров Vector,
+// SingleLinkedList и DoubleLinkedList. Задаётся при сборке, например
+// -DCONTAINERS_CHECK_LEVEL=CONTAINERS_CHECK_NONE, и должен совпадать во
+// всех единицах трансляции программы. at() проверяет индекс всегда
+#define CONTAINERS_CHECK_NONE 0
+#define CONTAINERS_CHECK_ASSERT 1
+#define CONTAINERS_CHECK_THROW 2
+
+#ifndef CONTAINERS_CHECK_LEVEL
+#define CONTAINERS_CHECK_LEVEL CONTAINERS_CHECK_ASSERT
+#endif
+
+#if CONTAINERS_CHECK_LEVEL < CONTAINERS_CHECK_NONE ||                          \
+    CONTAINERS_CHECK_LEVEL > CONTAINERS_CHECK_THROW
+#error "CONTAINERS_CHECK_LEVEL must be NONE, ASSERT or THROW"
+#endif
+
+namespace check {
+
+enum class Level { None, Assert, Throw };
+
+inline constexpr Level kLevel = static_cast<Level>(CONTAINERS_CHECK_LEVEL);
+
+// Проверяемые операции объявлены noexcept(kNothrow): бросить они могут
+// только в режиме Throw
+inline constexpr bool kNothrow = kLevel != Level::Throw;
+
+// Проверка по текущему режиму. В режиме None условие не вычисляется
+// отдельно и исчезает вместе с ветвлением, в режиме Assert — при NDEBUG
+inline void require(bool condition, const char *message) noexcept(kNothrow) {
+  if constexpr (kLevel == Level::Throw) {
+    if (!condition) {
+      throw std::out_of_range(message);
+    }
+  } else if constexpr (kLevel == Level::Assert) {
+    assert(condition && message);
+    (void)condition, (void)message;
+  } else {
+    (void)condition, (void)message;
+  }
+}
+
+// Проверка независимо от режима, для at()
+inline void always(bool condition, const char *message) {
+  if (!condition) {
+    throw std::out_of_range(message);
+  }
+}
+
+} // end namespace check
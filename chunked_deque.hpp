@@ -0,0 +1,351 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace chunked_deque {
+
+// Число элементов в блоке: степень двойки, блок занимает около 4 КБ
+template <typename T>
+constexpr size_t default_block_size() {
+  size_t size = 16;
+  while (size * 2 * sizeof(T) <= 4096) {
+    size *= 2;
+  }
+  return size;
+}
+
+// Дек из блоков фиксированного размера и карты блоков.
+// Элементы никогда не перемещаются при росте: push/pop с обоих концов не
+// инвалидируют ссылки на остальные элементы
+template <typename T, size_t BlockSize = default_block_size<T>()>
+class ChunkedDeque {
+  static_assert((BlockSize & (BlockSize - 1)) == 0,
+                "BlockSize must be a power of two");
+
+  using Block = vector::RawMemory<T>;
+
+  // Итератор хранит индекс элемента, адрес вычисляется через карту блоков
+  template <typename ValueType> class BasicIterator {
+    friend class ChunkedDeque;
+    template <typename> friend class BasicIterator;
+    using Owner = std::conditional_t<std::is_const_v<ValueType>,
+                                     const ChunkedDeque, ChunkedDeque>;
+
+    BasicIterator(Owner *owner, size_t index) noexcept
+        : owner_(owner), index_(index) {}
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    BasicIterator(const BasicIterator<T> &other) noexcept
+        : owner_(other.owner_), index_(other.index_) {}
+
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+    pointer operator->() const noexcept { return &(*owner_)[index_]; }
+    reference operator[](difference_type n) const noexcept {
+      return (*owner_)[index_ + n];
+    }
+
+    BasicIterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    BasicIterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++index_;
+      return old_value;
+    }
+    BasicIterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    BasicIterator operator--(int) noexcept {
+      auto old_value(*this);
+      --index_;
+      return old_value;
+    }
+    BasicIterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    BasicIterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    BasicIterator operator+(difference_type n) const noexcept {
+      return BasicIterator(owner_, index_ + n);
+    }
+    friend BasicIterator operator+(difference_type n,
+                                   const BasicIterator &it) noexcept {
+      return it + n;
+    }
+    BasicIterator operator-(difference_type n) const noexcept {
+      return BasicIterator(owner_, index_ - n);
+    }
+    difference_type operator-(const BasicIterator &rhs) const noexcept {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(rhs.index_);
+    }
+
+    bool operator==(const BasicIterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const BasicIterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+    bool operator<(const BasicIterator &rhs) const noexcept {
+      return index_ < rhs.index_;
+    }
+    bool operator>(const BasicIterator &rhs) const noexcept {
+      return index_ > rhs.index_;
+    }
+    bool operator<=(const BasicIterator &rhs) const noexcept {
+      return index_ <= rhs.index_;
+    }
+    bool operator>=(const BasicIterator &rhs) const noexcept {
+      return index_ >= rhs.index_;
+    }
+
+  private:
+    Owner *owner_ = nullptr;
+    size_t index_ = 0;
+  };
+
+public:
+  using value_type = T;
+  using iterator = BasicIterator<T>;
+  using const_iterator = BasicIterator<const T>;
+
+  static constexpr size_t block_size = BlockSize;
+
+  ChunkedDeque() = default;
+
+  ChunkedDeque(std::initializer_list<T> values) : ChunkedDeque() {
+    for (const T &value : values) {
+      push_back(value);
+    }
+  }
+
+  ChunkedDeque(const ChunkedDeque &other) : ChunkedDeque() {
+    for (const T &value : other) {
+      push_back(value);
+    }
+  }
+
+  ChunkedDeque(ChunkedDeque &&other) noexcept { swap(other); }
+
+  ChunkedDeque &operator=(const ChunkedDeque &rhs) {
+    if (this != &rhs) {
+      ChunkedDeque copy(rhs);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  ChunkedDeque &operator=(ChunkedDeque &&rhs) noexcept {
+    swap(rhs);
+    return *this;
+  }
+
+  ~ChunkedDeque() {
+    clear();
+    std::destroy_n(map_.get_address(), map_.capacity());
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cend() const noexcept { return const_iterator(this, size_); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // Объект, карта блоков и сами блоки, включая незанятые слоты
+  size_t memory_usage() const noexcept {
+    return sizeof(*this) + map_.capacity() * sizeof(Block) +
+           blocks() * BlockSize * sizeof(T);
+  }
+
+  T &operator[](size_t index) noexcept { return *slot(start_ + index); }
+  const T &operator[](size_t index) const noexcept {
+    return const_cast<ChunkedDeque &>(*this)[index];
+  }
+
+  T &front() noexcept { return (*this)[0]; }
+  const T &front() const noexcept { return (*this)[0]; }
+  T &back() noexcept { return (*this)[size_ - 1]; }
+  const T &back() const noexcept { return (*this)[size_ - 1]; }
+
+  void swap(ChunkedDeque &other) noexcept {
+    map_.swap(other.map_);
+    std::swap(map_begin_, other.map_begin_);
+    std::swap(map_end_, other.map_end_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+  }
+
+  void push_back(const T &value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+  void push_front(const T &value) { emplace_front(value); }
+  void push_front(T &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args> T &emplace_back(Args &&...args) {
+    if (start_ + size_ == blocks() * BlockSize) {
+      add_back_block();
+    }
+    T *new_slot = slot(start_ + size_);
+    new (new_slot) T(std::forward<Args>(args)...);
+    ++size_;
+    return *new_slot;
+  }
+
+  template <typename... Args> T &emplace_front(Args &&...args) {
+    const bool added = start_ == 0;
+    if (added) {
+      add_front_block();
+    }
+    T *new_slot = slot(start_ - 1);
+    try {
+      new (new_slot) T(std::forward<Args>(args)...);
+    } catch (...) {
+      // Пустой головной блок иначе остался бы в карте: pop_front освобождает
+      // блок только когда start_ доходит ровно до BlockSize
+      if (added) {
+        release_front_block();
+        start_ = 0;
+      }
+      throw;
+    }
+    --start_;
+    ++size_;
+    return *new_slot;
+  }
+
+  void pop_back() {
+    if (size_) {
+      std::destroy_at(&back());
+      --size_;
+      // Освобождаем хвостовой блок, как только он полностью опустел
+      if (blocks() * BlockSize - (start_ + size_) >= BlockSize) {
+        release_back_block();
+      }
+    }
+  }
+
+  void pop_front() {
+    if (size_) {
+      std::destroy_at(&front());
+      ++start_;
+      --size_;
+      if (start_ == BlockSize) {
+        release_front_block();
+        start_ = 0;
+      }
+    }
+  }
+
+  void clear() noexcept {
+    while (size_) {
+      std::destroy_at(&back());
+      --size_;
+    }
+    while (blocks()) {
+      release_back_block();
+    }
+    start_ = 0;
+  }
+
+private:
+  // Карта блоков: занятые слоты [map_begin_, map_end_), остальные — пустые
+  // RawMemory без буфера
+  vector::RawMemory<Block> map_;
+  size_t map_begin_ = 0;
+  size_t map_end_ = 0;
+  // Смещение первого элемента в первом блоке
+  size_t start_ = 0;
+  size_t size_ = 0;
+
+  size_t blocks() const noexcept { return map_end_ - map_begin_; }
+
+  // Адрес позиции position, отсчитанной от начала первого блока
+  T *slot(size_t position) noexcept {
+    return map_.get_address()[map_begin_ + position / BlockSize]
+               .get_address() +
+           position % BlockSize;
+  }
+
+  void add_back_block() {
+    if (map_end_ == map_.capacity()) {
+      grow_map();
+    }
+    Block block(BlockSize);
+    map_.get_address()[map_end_].swap(block);
+    ++map_end_;
+  }
+
+  void add_front_block() {
+    if (map_begin_ == 0) {
+      grow_map();
+    }
+    Block block(BlockSize);
+    map_.get_address()[map_begin_ - 1].swap(block);
+    --map_begin_;
+    start_ += BlockSize;
+  }
+
+  void release_back_block() noexcept {
+    --map_end_;
+    Block().swap(map_.get_address()[map_end_]);
+  }
+
+  void release_front_block() noexcept {
+    Block().swap(map_.get_address()[map_begin_]);
+    ++map_begin_;
+  }
+
+  // Перестраивает карту так, чтобы занятые слоты оказались посередине и с
+  // обеих сторон был запас. Переносятся только дескрипторы блоков, элементы
+  // остаются на месте
+  void grow_map() {
+    const size_t used = blocks();
+    const size_t new_capacity = std::max<size_t>(8, used * 2 + 2);
+    vector::RawMemory<Block> new_map(new_capacity);
+    std::uninitialized_value_construct_n(new_map.get_address(), new_capacity);
+
+    const size_t new_begin = (new_capacity - used) / 2;
+    for (size_t i = 0; i < used; ++i) {
+      new_map.get_address()[new_begin + i].swap(
+          map_.get_address()[map_begin_ + i]);
+    }
+
+    std::destroy_n(map_.get_address(), map_.capacity());
+    map_.swap(new_map);
+    map_begin_ = new_begin;
+    map_end_ = new_begin + used;
+  }
+};
+
+template <typename T, size_t BlockSize>
+bool operator==(const ChunkedDeque<T, BlockSize> &lhs,
+                const ChunkedDeque<T, BlockSize> &rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+} // end namespace chunked_deque
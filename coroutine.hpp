@@ -0,0 +1,350 @@
+#pragma once
+#if __cplusplus < 202002L || !__has_include(<coroutine>)
+#error "coroutine.hpp requires C++20: configure with -DCONTAINERS_CXX20=ON"
+#endif
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "chunked_deque.hpp"
+#include "parallel.hpp"
+#include "vector.hpp"
+
+namespace coroutine {
+
+// Ленивый генератор: тело сопрограммы выполняется по мере обхода, каждое
+// co_yield отдаёт один элемент. Исключение из тела пробрасывается из
+// begin() или ++
+template <typename T> class Generator {
+public:
+  struct promise_type {
+    const T *value = nullptr;
+    std::exception_ptr error;
+
+    Generator get_return_object() noexcept {
+      return Generator(Handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    // Отдаваемый объект живёт в кадре сопрограммы до следующего возобновления
+    std::suspend_always yield_value(const T &item) noexcept {
+      value = std::addressof(item);
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  class iterator {
+    friend class Generator;
+
+    explicit iterator(Handle handle) noexcept : handle_(handle) {}
+
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    iterator() = default;
+
+    reference operator*() const noexcept { return *handle_.promise().value; }
+    pointer operator->() const noexcept { return handle_.promise().value; }
+
+    iterator &operator++() {
+      advance(handle_);
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const noexcept {
+      return !handle_ || handle_.done();
+    }
+
+  private:
+    Handle handle_;
+  };
+
+  Generator(Generator &&other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+
+  Generator &operator=(Generator &&rhs) noexcept {
+    std::swap(handle_, rhs.handle_);
+    return *this;
+  }
+
+  ~Generator() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  // Обход однократный: begin() запускает тело до первого co_yield
+  iterator begin() {
+    if (handle_) {
+      advance(handle_);
+    }
+    return iterator(handle_);
+  }
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+  Handle handle_;
+
+  explicit Generator(Handle handle) noexcept : handle_(handle) {}
+
+  static void advance(Handle handle) {
+    handle.resume();
+    if (handle.promise().error) {
+      std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+    }
+  }
+};
+
+// Сопрограмма, выполняемая в пуле потоков. Создаётся приостановленной,
+// start ставит её в TaskGroup; после каждого ожидания канала она
+// возобновляется задачей той же группы. TaskGroup::wait дожидается
+// завершения и пробрасывает исключение из тела. Объект Task должен жить,
+// пока группа не дождётся сопрограммы
+class Task {
+public:
+  struct promise_type {
+    parallel::TaskGroup *group = nullptr;
+
+    Task get_return_object() noexcept {
+      return Task(Handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    // Исключение выходит из resume() и перехватывается задачей группы
+    void unhandled_exception() { throw; }
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+  Task &operator=(Task &&rhs) noexcept {
+    std::swap(handle_, rhs.handle_);
+    return *this;
+  }
+
+  ~Task() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  void start(parallel::TaskGroup &group) {
+    handle_.promise().group = &group;
+    resume(handle_);
+  }
+
+  bool done() const noexcept { return handle_.done(); }
+
+  // Ставит возобновление сопрограммы в её группу задач
+  static void resume(Handle handle) {
+    handle.promise().group->run([handle] { handle.resume(); });
+  }
+
+private:
+  Handle handle_;
+
+  explicit Task(Handle handle) noexcept : handle_(handle) {}
+};
+
+// Ограниченная очередь пакетов между сопрограммами Task. send
+// приостанавливает отправителя, пока в очереди capacity пакетов, receive —
+// получателя, пока очередь пуста. Приостановленная сопрограмма не занимает
+// поток пула: её возобновление ставится в пул парной операцией
+template <typename T> class AsyncChannel {
+public:
+  using Batch = vector::Vector<T>;
+
+  class SendAwaiter {
+    friend class AsyncChannel;
+
+    SendAwaiter(AsyncChannel *channel, Batch batch) noexcept
+        : channel_(channel), batch_(std::move(batch)) {}
+
+  public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(Task::Handle handle) {
+      return channel_->suspend_send(*this, handle);
+    }
+    void await_resume() const noexcept {}
+
+  private:
+    AsyncChannel *channel_;
+    Batch batch_;
+    Task::Handle handle_;
+  };
+
+  class ReceiveAwaiter {
+    friend class AsyncChannel;
+
+    explicit ReceiveAwaiter(AsyncChannel *channel) noexcept
+        : channel_(channel) {}
+
+  public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(Task::Handle handle) {
+      return channel_->suspend_receive(*this, handle);
+    }
+    // Пустое значение — канал закрыт и все пакеты получены
+    std::optional<Batch> await_resume() noexcept { return std::move(result_); }
+
+  private:
+    AsyncChannel *channel_;
+    std::optional<Batch> result_;
+    Task::Handle handle_;
+  };
+
+  explicit AsyncChannel(size_t capacity = 4)
+      : capacity_(std::max<size_t>(capacity, 1)) {}
+
+  AsyncChannel(const AsyncChannel &) = delete;
+  AsyncChannel &operator=(const AsyncChannel &) = delete;
+
+  // Отправка в закрытый канал выбрасывает std::logic_error
+  [[nodiscard]] SendAwaiter send(Batch batch) noexcept {
+    return SendAwaiter(this, std::move(batch));
+  }
+
+  [[nodiscard]] ReceiveAwaiter receive() noexcept {
+    return ReceiveAwaiter(this);
+  }
+
+  // Ожидающие получатели возобновляются с пустым значением; пакеты, уже
+  // стоящие в очереди, остаются доступны
+  void close() {
+    chunked_deque::ChunkedDeque<ReceiveAwaiter *> waiting;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      std::swap(waiting, receivers_);
+    }
+    for (ReceiveAwaiter *receiver : waiting) {
+      Task::resume(receiver->handle_);
+    }
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return batches_.size();
+  }
+
+  size_t capacity() const noexcept { return capacity_; }
+
+private:
+  mutable std::mutex mutex_;
+  chunked_deque::ChunkedDeque<Batch> batches_;
+  chunked_deque::ChunkedDeque<SendAwaiter *> senders_;
+  chunked_deque::ChunkedDeque<ReceiveAwaiter *> receivers_;
+  size_t capacity_;
+  bool closed_ = false;
+
+  // После возврата true сопрограмму может возобновить другой поток, поэтому
+  // awaiter изменяется только под блокировкой
+  bool suspend_send(SendAwaiter &sender, Task::Handle handle) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_) {
+      throw std::logic_error("Channel is closed");
+    }
+    if (!receivers_.empty()) {
+      // Очередь пуста: пакет передаётся ожидающему получателю напрямую
+      ReceiveAwaiter *receiver = receivers_.front();
+      receivers_.pop_front();
+      receiver->result_.emplace(std::move(sender.batch_));
+      lock.unlock();
+      Task::resume(receiver->handle_);
+      return false;
+    }
+    if (batches_.size() < capacity_) {
+      batches_.push_back(std::move(sender.batch_));
+      return false;
+    }
+    sender.handle_ = handle;
+    senders_.push_back(&sender);
+    return true;
+  }
+
+  bool suspend_receive(ReceiveAwaiter &receiver, Task::Handle handle) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!batches_.empty()) {
+      receiver.result_.emplace(std::move(batches_.front()));
+      batches_.pop_front();
+      if (!senders_.empty()) {
+        // Освободилось место: пакет ожидающего отправителя встаёт в очередь
+        SendAwaiter *sender = senders_.front();
+        senders_.pop_front();
+        batches_.push_back(std::move(sender->batch_));
+        lock.unlock();
+        Task::resume(sender->handle_);
+      }
+      return false;
+    }
+    if (closed_) {
+      return false;
+    }
+    receiver.handle_ = handle;
+    receivers_.push_back(&receiver);
+    return true;
+  }
+};
+
+// Производитель: перекладывает элементы генератора в канал пакетами по
+// batch_size и закрывает канал по окончании, в том числе при исключении
+template <typename T>
+Task pump(Generator<T> source, AsyncChannel<T> &channel, size_t batch_size) {
+  try {
+    vector::Vector<T> batch;
+    batch.reserve(batch_size);
+    for (const T &item : source) {
+      batch.push_back(item);
+      if (batch.size() >= batch_size) {
+        co_await channel.send(std::exchange(batch, vector::Vector<T>()));
+        batch.reserve(batch_size);
+      }
+    }
+    if (!batch.empty()) {
+      co_await channel.send(std::move(batch));
+    }
+  } catch (...) {
+    channel.close();
+    throw;
+  }
+  channel.close();
+}
+
+// Потребитель: передаёт пакеты в process по мере поступления, пока канал не
+// закрыт
+template <typename T, typename F>
+Task consume(AsyncChannel<T> &channel, F process) {
+  while (auto batch = co_await channel.receive()) {
+    process(std::move(*batch));
+  }
+}
+
+// Потребитель, дописывающий элементы в конец контейнера с push_back
+// (Vector, SingleLinkedList)
+template <typename T, typename Container>
+Task collect(AsyncChannel<T> &channel, Container &out) {
+  while (auto batch = co_await channel.receive()) {
+    for (T &item : *batch) {
+      out.push_back(std::move(item));
+    }
+  }
+}
+
+} // end namespace coroutine
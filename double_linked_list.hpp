@@ -4,20 +4,34 @@
 #include <initializer_list>
 #include <iostream>
 #include <string>
+#include <type_traits>
 #include <utility>
 
+#include "check.hpp"
+#include "telemetry.hpp"
+#include "vector.hpp"
+
 namespace double_linked_list {
 
 template <typename Type>
 class DoubleLinkedList {
-  // Узел списка
-  struct Node {
-    Node() = default;
-    Node(const Type &val, Node *prev, Node *next)
-        : value(val), prev_node(prev), next_node(next) {}
+  // Звено цепочки без значения. Из него состоит фиктивный узел перед
+  // первым элементом: он хранится прямо в объекте списка, поэтому пустой
+  // и перемещённый списки ничего не выделяют и остаются пригодными
+  struct NodeBase {
+    NodeBase *prev_node = nullptr;
+    NodeBase *next_node = nullptr;
+  };
+
+  // Узел списка. pooled — узел лежит в блоке, созданном compact(), и не
+  // освобождается поодиночке
+  struct Node : NodeBase {
+    Node(const Type &val, NodeBase *prev, NodeBase *next)
+        : NodeBase{prev, next}, value(val) {}
+    Node(Type &&val, NodeBase *prev, NodeBase *next)
+        : NodeBase{prev, next}, value(std::move(val)) {}
     Type value;
-    Node *prev_node = nullptr;
-    Node *next_node = nullptr;
+    bool pooled = false;
   };
 
   // Шаблон класса «Базовый Итератор».
@@ -30,8 +44,10 @@ class DoubleLinkedList {
     // был доступ к приватной области итератора
     friend class DoubleLinkedList;
 
-    // Конвертирующий конструктор итератора из указателя на узел списка
-    explicit BasicIterator(Node *node) { node_ = node; }
+    // Конвертирующий конструктор итератора из указателя на узел списка и
+    // указателя на поле end_ списка
+    BasicIterator(NodeBase *node, NodeBase *const *last) noexcept
+        : node_(node), last_(last) {}
 
    public:
     // Объявленные ниже типы сообщают стандартной библиотеке о свойствах этого
@@ -56,9 +72,8 @@ class DoubleLinkedList {
     // При ValueType, совпадающем с Type, играет роль копирующего конструктора
     // При ValueType, совпадающем с const Type, играет роль конвертирующего
     // конструктора
-    BasicIterator(const BasicIterator<Type> &other) noexcept {
-      node_ = other.node_;
-    }
+    BasicIterator(const BasicIterator<Type> &other) noexcept
+        : node_(other.node_), last_(other.last_) {}
 
     // Чтобы компилятор не выдавал предупреждение об отсутствии оператора = при
     // наличии пользовательского конструктора копирования, явно объявим оператор
@@ -114,8 +129,9 @@ class DoubleLinkedList {
       return old_value;
     }
 
+    // Декремент end() переходит к последнему элементу списка
     BasicIterator &operator--() noexcept {
-      node_ = node_->prev_node;
+      node_ = node_ ? node_->prev_node : *last_;
       return *this;
     }
 
@@ -128,21 +144,26 @@ class DoubleLinkedList {
     // Операция разыменования. Возвращает ссылку на текущий элемент
     // Вызов этого оператора у итератора, не указывающего на существующий
     // элемент списка, приводит к неопределённому поведению
-    [[nodiscard]] reference operator*() const noexcept { return node_->value; }
+    [[nodiscard]] reference operator*() const noexcept {
+      return static_cast<Node *>(node_)->value;
+    }
 
     // Операция доступа к члену класса. Возвращает указатель на текущий элемент
     // списка Вызов этого оператора у итератора, не указывающего на существующий
     // элемент списка, приводит к неопределённому поведению
     [[nodiscard]] pointer operator->() const noexcept {
       if (node_) {
-        return &node_->value;
+        return &static_cast<Node *>(node_)->value;
       } else {
         return nullptr;
       }
     }
 
    private:
-    Node *node_ = nullptr;
+    NodeBase *node_ = nullptr;
+    // end() хранит нулевой узел, поэтому для обратного обхода итератору
+    // нужен последний узел списка
+    NodeBase *const *last_ = nullptr;
   };
 
  public:
@@ -157,18 +178,18 @@ class DoubleLinkedList {
 
   // Возвращает итератор, ссылающийся на первый элемент
   // Если список пустой, возвращённый итератор будет равен end()
-  [[nodiscard]] Iterator begin() noexcept { return Iterator(head_->next_node); }
+  [[nodiscard]] Iterator begin() noexcept { return Iterator(head_.next_node, &end_); }
 
   // Возвращает итератор, указывающий на позицию, следующую за последним
   // элементом односвязного списка Разыменовывать этот итератор нельзя — попытка
   // разыменования приведёт к неопределённому поведению
-  [[nodiscard]] Iterator end() noexcept { return Iterator(nullptr); }
+  [[nodiscard]] Iterator end() noexcept { return Iterator(nullptr, &end_); }
 
   // Возвращает константный итератор, ссылающийся на первый элемент
   // Если список пустой, возвращённый итератор будет равен end()
   // Результат вызова эквивалентен вызову метода cbegin()
   [[nodiscard]] ConstIterator begin() const noexcept {
-    return ConstIterator(head_->next_node);
+    return ConstIterator(head_.next_node, &end_);
   }
 
   // Возвращает константный итератор, указывающий на позицию, следующую за
@@ -176,31 +197,43 @@ class DoubleLinkedList {
   // — попытка разыменования приведёт к неопределённому поведению Результат
   // вызова эквивалентен вызову метода cend()
   [[nodiscard]] ConstIterator end() const noexcept {
-    return ConstIterator(nullptr);
+    return ConstIterator(nullptr, &end_);
   }
 
   // Возвращает константный итератор, ссылающийся на первый элемент
   // Если список пустой, возвращённый итератор будет равен cend()
   [[nodiscard]] ConstIterator cbegin() const noexcept {
-    return ConstIterator(head_->next_node);
+    return ConstIterator(head_.next_node, &end_);
   }
 
   // Возвращает константный итератор, указывающий на позицию, следующую за
   // последним элементом односвязного списка Разыменовывать этот итератор нельзя
   // — попытка разыменования приведёт к неопределённому поведению
   [[nodiscard]] ConstIterator cend() const noexcept {
-    return ConstIterator(nullptr);
+    return ConstIterator(nullptr, &end_);
   }
 
  public:
-  DoubleLinkedList() {
-    head_ = new Node();
-    end_ = new Node();
-  };
+  DoubleLinkedList() = default;
 
   // Возвращает количество элементов в списке за время O(1)
   [[nodiscard]] size_t size() const noexcept { return size_; }
 
+  // Возвращает число байт, занятых списком: сам объект (вместе с фиктивным
+  // узлом) и узлы с элементами. Каждый узел помимо значения хранит
+  // указатели на соседей
+  [[nodiscard]] size_t memory_usage() const noexcept {
+    size_t block_slots = 0;
+    for (const auto &block : blocks_) {
+      block_slots += block.capacity();
+    }
+    for (const auto &block : compaction_.blocks) {
+      block_slots += block.capacity();
+    }
+    return sizeof(*this) +
+           (size_ - pooled_size_ + block_slots) * sizeof(Node);
+  }
+
   DoubleLinkedList(std::initializer_list<Type> values) {
     DoubleLinkedList temp;
     temp.init(values.begin(), values.end());
@@ -208,35 +241,23 @@ class DoubleLinkedList {
   }
 
   // Move ctor
-  DoubleLinkedList(DoubleLinkedList &&other) {
-    size_ = other.size_;
-    other.size_ = 0;
-    head_ = other.head_;
-    other.head_ = nullptr;
-    end_ = other.end_;
-    other.end_ = nullptr;
-  }
+  DoubleLinkedList(DoubleLinkedList &&other) noexcept { swap(other); }
 
   // Move assignment operator
-  DoubleLinkedList &operator=(DoubleLinkedList &&rhs) {
-    size_ = rhs.size_;
-    rhs.size_ = 0;
-    head_ = rhs.head_;
-    rhs.head_ = nullptr;
-    end_ = rhs.end_;
-    rhs.end_ = nullptr;
-
+  DoubleLinkedList &operator=(DoubleLinkedList &&rhs) noexcept {
+    swap(rhs);
     return *this;
   }
 
   template <typename TypeIt>
   void init(TypeIt begin, TypeIt end) {
-    Node *node = head_;
+    NodeBase *node = &head_;
     for (TypeIt i = begin; i != end; ++i) {
       ++size_;
-      node->next_node = new Node(*i, nullptr, nullptr);
+      node->next_node = new Node(*i, node, nullptr);
       node = node->next_node;
     }
+    end_ = node;
   }
 
   DoubleLinkedList(const DoubleLinkedList &other) {
@@ -245,16 +266,16 @@ class DoubleLinkedList {
     swap(temp);
   }
 
-  Type &operator[](const size_t index) {
-    if (index >= size_) {
-      throw std::out_of_range("Index");
-    } else {
-      Node *p = head_->next_node;
-      for (size_t i = 0; i != index; ++i) {
-        p = p->next_node;
-      }
-      return p->value;
-    }
+  // Проверка индекса зависит от CONTAINERS_CHECK_LEVEL (check.hpp)
+  Type &operator[](const size_t index) noexcept(check::kNothrow) {
+    check::require(index < size_, "Index");
+    return node_at(index)->value;
+  }
+
+  // Индекс проверяется всегда, при выходе за размер — std::out_of_range
+  Type &at(const size_t index) {
+    check::always(index < size_, "Index");
+    return node_at(index)->value;
   }
 
   DoubleLinkedList &operator=(const DoubleLinkedList &rhs) {
@@ -265,13 +286,21 @@ class DoubleLinkedList {
     return *this;
   }
 
-  // Обменивает содержимое списков за время O(1)
+  // Обменивает содержимое списков за время O(1). Фиктивные узлы остаются
+  // на месте, обмениваются цепочки за ними
   void swap(DoubleLinkedList &other) noexcept {
-      std::swap(head_, other.head_);
-      other.head_ = nullptr;
+      std::swap(head_.next_node, other.head_.next_node);
       std::swap(end_, other.end_);
-      other.end_ = nullptr;
+      relink_head();
+      other.relink_head();
       std::swap(size_, other.size_);
+      blocks_.swap(other.blocks_);
+      std::swap(pooled_size_, other.pooled_size_);
+      compaction_.blocks.swap(other.compaction_.blocks);
+      std::swap(compaction_.cursor, other.compaction_.cursor);
+      std::swap(compaction_.used, other.compaction_.used);
+      std::swap(compaction_.moved, other.compaction_.moved);
+      std::swap(compaction_.active, other.compaction_.active);
   }
 
   // Сообщает, пустой ли список за время O(1)
@@ -284,18 +313,24 @@ class DoubleLinkedList {
 
   // Вставляет элемент value в начало списка за время O(1)
   void push_front(const Type &value) {
-    head_->next_node = new Node(value, head_, head_->next_node);
+    telemetry::Scope scope(telemetry::Container::DoubleLinkedList,
+                           telemetry::Operation::Push);
+    head_.next_node = new Node(value, &head_, head_.next_node);
     if (size_ == 0) {
-      end_ = head_->next_node;
+      end_ = head_.next_node;
+    } else {
+      head_.next_node->next_node->prev_node = head_.next_node;
     }
     ++size_;
   }
 
   void push_back(const Type &value) {
+    telemetry::Scope scope(telemetry::Container::DoubleLinkedList,
+                           telemetry::Operation::Push);
     if (size_ == 0) {
       push_front(value);
     } else {
-      Node *new_node = new Node(value, nullptr,
+      Node *new_node = new Node(value, end_,
                                 nullptr);  // обновляем указатель на последний
       end_->next_node = new_node;
       end_ = new_node;
@@ -304,39 +339,130 @@ class DoubleLinkedList {
     }
   }
 
+  // Обходит элементы, заранее запрашивая следующий узел в кэш, пока f
+  // обрабатывает текущий. Если следующий узел лежит в памяти сразу за
+  // текущим, подсказка не нужна: такой поток отслеживает аппаратная
+  // предвыборка
+  template <typename F>
+  void for_each(F f) {
+    for (Node *node = as_node(head_.next_node); node;) {
+      Node *next = as_node(node->next_node);
+      if (next != node + 1) {
+        prefetch(next);
+      }
+      f(node->value);
+      node = next;
+    }
+  }
+
+  template <typename T, typename Reduce, typename Transform>
+  T transform_reduce(T init, Reduce reduce, Transform transform) {
+    for_each([&](Type &value) {
+      init = reduce(std::move(init), transform(value));
+    });
+    return init;
+  }
+
+  // Обходит несколько независимых списков по очереди, по одному элементу из
+  // каждого: промахи кэша в разных цепочках обслуживаются параллельно,
+  // тогда как внутри одной цепочки адрес следующего узла известен только
+  // после загрузки текущего. f вызывается как f(номер списка, элемент)
+  template <typename F, typename... Lists>
+  static void for_each_interleaved(F f, Lists &...lists) {
+    static_assert((std::is_same_v<Lists, DoubleLinkedList> && ...),
+                  "All lists must have the same type");
+    Node *cursors[] = {as_node(lists.head_.next_node)...};
+    size_t active = 0;
+    for (Node *cursor : cursors) {
+      active += cursor != nullptr;
+    }
+    while (active) {
+      for (size_t i = 0; i < sizeof...(Lists); ++i) {
+        Node *&cursor = cursors[i];
+        if (!cursor) {
+          continue;
+        }
+        Node *next = as_node(cursor->next_node);
+        prefetch(next);
+        f(i, cursor->value);
+        cursor = next;
+        active -= cursor == nullptr;
+      }
+    }
+  }
+
   void print() {
     if (is_empty()) {
       std::cout << "Double linked list is empty" << std::endl;
       return;
     } 
-    Node *p = head_->next_node;
-    while (p) {
+    for (Node *p = as_node(head_.next_node); p; p = as_node(p->next_node)) {
       std::cout << p->value << " ";
-      p = p->next_node;
     }
     std::cout << std::endl;
   }
 
   // Очищает список за время O(N)
   void clear() noexcept {
-    if (head_){
-      while (head_->next_node) {
-        delete std::exchange(head_->next_node, head_->next_node->next_node);
-      }
+    telemetry::Scope scope(telemetry::Container::DoubleLinkedList,
+                           telemetry::Operation::Clear);
+    while (head_.next_node) {
+      destroy_node(
+          as_node(std::exchange(head_.next_node, head_.next_node->next_node)));
+    }
     size_ = 0;
-  }
+    end_ = &head_;
+    blocks_.clear_and_release();
+    compaction_.blocks.clear_and_release();
+    compaction_.cursor = nullptr;
+    compaction_.active = false;
 }
 
+  // Переносит все узлы в один непрерывный блок в порядке обхода, после чего
+  // соседние элементы лежат в памяти подряд. Итераторы и ссылки на элементы
+  // становятся недействительными. Если при переносе значения будет
+  // выброшено исключение, список останется корректным
+  void compact() {
+    while (!compact_step(static_cast<size_t>(-1))) {
+    }
+  }
+
+  // Инкрементальное уплотнение: переносит не более budget узлов и
+  // возвращает true, когда проход завершён. Между шагами список можно
+  // изменять; узлы, вставленные позади текущей позиции прохода, в нём не
+  // участвуют. Старые блоки освобождаются в конце прохода
+  bool compact_step(size_t budget) {
+    if (!compaction_.active) {
+      compaction_.active = true;
+      compaction_.cursor = as_node(head_.next_node);
+      compaction_.used = 0;
+      compaction_.moved = 0;
+    }
+    for (; budget != 0 && compaction_.cursor; --budget) {
+      relocate(compaction_.cursor);
+    }
+    if (compaction_.cursor) {
+      return false;
+    }
+    // Все узлы старых блоков перенесены или удалены
+    blocks_.swap(compaction_.blocks);
+    compaction_.blocks.clear_and_release();
+    compaction_.active = false;
+    return true;
+  }
+
   // Возвращает итератор, указывающий на позицию перед первым элементом
   // односвязного списка. Разыменовывать этот итератор нельзя - попытка
   // разыменования приведёт к неопределённому поведению
-  [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
+  [[nodiscard]] Iterator before_begin() noexcept {
+    return Iterator(&head_, &end_);
+  }
 
   // Возвращает константный итератор, указывающий на позицию перед первым
   // элементом односвязного списка. Разыменовывать этот итератор нельзя -
   // попытка разыменования приведёт к неопределённому поведению
   [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-    return ConstIterator{const_cast<Node *>(&head_)};
+    return ConstIterator(const_cast<NodeBase *>(&head_), &end_);
   }
 
   // Возвращает константный итератор, указывающий на позицию перед первым
@@ -353,20 +479,28 @@ class DoubleLinkedList {
    * прежнем состоянии
    */
   Iterator insert(ConstIterator pos, const Type &value) {
+    telemetry::Scope scope(telemetry::Container::DoubleLinkedList,
+                           telemetry::Operation::Insert);
     if (pos.node_) {
       auto &new_node = pos.node_;
       new_node->next_node = new Node(value, new_node, new_node->next_node);
+      if (new_node->next_node->next_node) {
+        new_node->next_node->next_node->prev_node = new_node->next_node;
+      } else {
+        end_ = new_node->next_node;
+      }
       ++size_;
-      return Iterator{new_node->next_node};
+      return Iterator(new_node->next_node, &end_);
     } else {
-      return Iterator(nullptr);
+      return Iterator(nullptr, &end_);
     }
   }
 
   void pop_front() noexcept {
+    telemetry::Scope scope(telemetry::Container::DoubleLinkedList,
+                           telemetry::Operation::Erase);
     if (size_ != 0) {
-      delete std::exchange(head_->next_node, head_->next_node->next_node);
-      --size_;
+      unlink_after(&head_);
     }
   }
 
@@ -375,25 +509,126 @@ class DoubleLinkedList {
    * Возвращает итератор на элемент, следующий за удалённым
    */
   Iterator erase(ConstIterator pos) noexcept {
+    telemetry::Scope scope(telemetry::Container::DoubleLinkedList,
+                           telemetry::Operation::Erase);
     if (pos.node_ && pos.node_->next_node) {
-      --size_;
-      delete std::exchange(pos.node_->next_node,
-                           pos.node_->next_node->next_node);
-      return Iterator{pos.node_->next_node};
+      unlink_after(pos.node_);
+      return Iterator(pos.node_->next_node, &end_);
     } else {
-      return Iterator(nullptr);
+      return Iterator(nullptr, &end_);
     }
   }
 
   ~DoubleLinkedList() { clear(); }
 
  private:
+  static void prefetch(const void *address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+  }
+
+  static Node *as_node(NodeBase *node) noexcept {
+    return static_cast<Node *>(node);
+  }
+
+  // После обмена цепочками первый узел должен ссылаться назад на свой
+  // фиктивный узел, а у пустого списка последним узлом считается фиктивный
+  void relink_head() noexcept {
+    if (head_.next_node) {
+      head_.next_node->prev_node = &head_;
+    } else {
+      end_ = &head_;
+    }
+  }
+
+  // Удаляет узел, следующий за node
+  void unlink_after(NodeBase *node) noexcept {
+    Node *removed = as_node(node->next_node);
+    node->next_node = removed->next_node;
+    if (removed->next_node) {
+      removed->next_node->prev_node = node;
+    } else {
+      end_ = node;
+    }
+    if (compaction_.cursor == removed) {
+      compaction_.cursor = as_node(removed->next_node);
+    }
+    destroy_node(removed);
+    --size_;
+  }
+
+  void destroy_node(Node *node) noexcept {
+    if (node->pooled) {
+      std::destroy_at(node);
+      --pooled_size_;
+    } else {
+      delete node;
+    }
+  }
+
+  // Переносит узел в очередной свободный слот блока уплотнения и
+  // сдвигает позицию прохода на следующий узел
+  void relocate(Node *node) {
+    if (compaction_.blocks.empty() ||
+        compaction_.used == compaction_.blocks[compaction_.blocks.size() - 1]
+                                .capacity()) {
+      const size_t slots =
+          size_ > compaction_.moved ? size_ - compaction_.moved : 1;
+      compaction_.blocks.push_back(vector::RawMemory<Node>(slots));
+      compaction_.used = 0;
+    }
+    Node *slot = compaction_.blocks[compaction_.blocks.size() - 1]
+                     .get_address() +
+                 compaction_.used;
+    new (slot) Node(std::move_if_noexcept(node->value), node->prev_node,
+                    node->next_node);
+    slot->pooled = true;
+    ++compaction_.used;
+    ++compaction_.moved;
+    ++pooled_size_;
+
+    slot->prev_node->next_node = slot;
+    if (slot->next_node) {
+      slot->next_node->prev_node = slot;
+    } else {
+      end_ = slot;
+    }
+    compaction_.cursor = as_node(slot->next_node);
+    destroy_node(node);
+  }
+
+  // Состояние незавершённого прохода compact_step
+  struct Compaction {
+    vector::Vector<vector::RawMemory<Node>> blocks;
+    Node *cursor = nullptr;
+    size_t used = 0;
+    size_t moved = 0;
+    bool active = false;
+  };
+
+  Node *node_at(size_t index) const noexcept {
+    NodeBase *p = head_.next_node;
+    for (size_t i = 0; i != index; ++i) {
+      p = p->next_node;
+    }
+    return as_node(p);
+  }
+
   // Фиктивный узел, используется для вставки "перед первым элементом"
-  Node *head_;
+  NodeBase head_;
 
-  Node *end_;
+  // Последний узел; у пустого списка — фиктивный
+  NodeBase *end_ = &head_;
 
   size_t size_ = 0;
+
+  // Блоки узлов, созданные compact(), и число живых узлов в них
+  vector::Vector<vector::RawMemory<Node>> blocks_;
+  size_t pooled_size_ = 0;
+  Compaction compaction_;
 };
 
 template <typename Type>
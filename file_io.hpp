@@ -0,0 +1,432 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+#include "vector.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FILE_IO_POSIX 1
+#endif
+
+// Определяется сборкой, если найден liburing
+#if defined(CONTAINERS_HAVE_LIBURING) && defined(__linux__)
+#include <liburing.h>
+#endif
+
+namespace file_io {
+
+// Выравнивание буфера, смещений и длин запросов для O_DIRECT
+constexpr size_t kDirectAlignment = 4096;
+
+struct Options {
+  // Размер одного запроса чтения или записи
+  size_t request_size = size_t{8} << 20;
+  // Число одновременных запросов: глубина очереди io_uring или число
+  // потоков pread/pwrite
+  size_t queue_depth = 4;
+  // Чтение и запись мимо страничного кэша. Требует вектора с выравниванием
+  // kDirectAlignment; если файловая система не поддерживает O_DIRECT,
+  // используется обычный ввод-вывод
+  bool direct = false;
+};
+
+namespace detail {
+
+// Ограничение длины одного pread/pwrite и запроса io_uring
+constexpr size_t kMaxRequestSize = size_t{1} << 30;
+
+inline size_t round_up(size_t value, size_t alignment) noexcept {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+#if defined(FILE_IO_POSIX)
+
+[[noreturn]] inline void throw_errno(int error, const std::string &what) {
+  throw std::system_error(error, std::generic_category(), what);
+}
+
+// Дескриптор файла, закрываемый в деструкторе
+class File {
+public:
+  File(const std::string &path, int flags, bool direct) : path_(path) {
+#if defined(O_DIRECT)
+    if (direct) {
+      fd_ = ::open(path.c_str(), flags | O_DIRECT, 0644);
+      direct_ = fd_ >= 0;
+      if (fd_ < 0 && errno != EINVAL) {
+        throw_errno(errno, "open " + path);
+      }
+    }
+#else
+    (void)direct;
+#endif
+    if (fd_ < 0) {
+      fd_ = ::open(path.c_str(), flags, 0644);
+    }
+    if (fd_ < 0) {
+      throw_errno(errno, "open " + path);
+    }
+  }
+
+  File(const File &) = delete;
+  File &operator=(const File &) = delete;
+
+  ~File() { ::close(fd_); }
+
+  int fd() const noexcept { return fd_; }
+  bool direct() const noexcept { return direct_; }
+  const std::string &path() const noexcept { return path_; }
+
+  size_t size() const {
+    struct stat info;
+    if (::fstat(fd_, &info) != 0) {
+      throw_errno(errno, "stat " + path_);
+    }
+    return static_cast<size_t>(info.st_size);
+  }
+
+  void resize(size_t size) {
+    if (::ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+      throw_errno(errno, "truncate " + path_);
+    }
+  }
+
+  // Невыровненный хвост записывается уже без O_DIRECT
+  void drop_direct() {
+#if defined(O_DIRECT)
+    if (direct_) {
+      const int flags = ::fcntl(fd_, F_GETFL);
+      if (flags < 0 || ::fcntl(fd_, F_SETFL, flags & ~O_DIRECT) != 0) {
+        throw_errno(errno, "fcntl " + path_);
+      }
+      direct_ = false;
+    }
+#endif
+  }
+
+private:
+  std::string path_;
+  int fd_ = -1;
+  bool direct_ = false;
+};
+
+// Один запрос: повторяется до полной передачи length байт. Чтение
+// останавливается на конце файла end — при O_DIRECT длина запроса
+// выровнена и может выходить за него
+template <bool Write>
+void transfer(const File &file, char *buffer, size_t length, size_t offset,
+              size_t end) {
+  while (length > 0 && offset < end) {
+    const ssize_t done =
+        Write ? ::pwrite(file.fd(), buffer, length, static_cast<off_t>(offset))
+              : ::pread(file.fd(), buffer, length, static_cast<off_t>(offset));
+    if (done < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw_errno(errno, (Write ? "write " : "read ") + file.path());
+    }
+    if (done == 0) {
+      throw std::runtime_error("Unexpected end of file " + file.path());
+    }
+    buffer += done;
+    length -= done;
+    offset += done;
+  }
+}
+
+// Запросы по request_size раздаются queue_depth потокам; вызывающий поток
+// участвует наравне с остальными. Первое исключение пробрасывается
+template <bool Write>
+void transfer_threads(const File &file, char *buffer, size_t length,
+                      size_t end, size_t request_size, size_t queue_depth) {
+  const size_t requests = (length + request_size - 1) / request_size;
+  std::atomic<size_t> next{0};
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto work = [&] {
+    try {
+      for (size_t request = next++; request < requests; request = next++) {
+        const size_t offset = request * request_size;
+        transfer<Write>(file, buffer + offset,
+                        std::min(request_size, length - offset), offset, end);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      next = requests;
+    }
+  };
+
+  const size_t threads = std::min(queue_depth, requests);
+  vector::Vector<std::thread> workers;
+  workers.reserve(threads > 0 ? threads - 1 : 0);
+  try {
+    for (size_t i = 1; i < threads; ++i) {
+      workers.emplace_back(work);
+    }
+  } catch (const std::system_error &) {
+    // Не удалось запустить поток: запросы выполнят уже запущенные
+  }
+  work();
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+#if defined(CONTAINERS_HAVE_LIBURING) && defined(__linux__)
+
+// queue_depth запросов одновременно в кольце io_uring. Недопереданный
+// остаток запроса отправляется повторно. false — кольцо создать не удалось
+template <bool Write>
+bool transfer_uring(const File &file, char *buffer, size_t length, size_t end,
+                    size_t request_size, size_t queue_depth) {
+  struct Slot {
+    size_t offset = 0;
+    size_t length = 0;
+  };
+
+  io_uring ring;
+  if (io_uring_queue_init(static_cast<unsigned>(queue_depth), &ring, 0) < 0) {
+    return false;
+  }
+  struct RingGuard {
+    io_uring *ring;
+    ~RingGuard() { io_uring_queue_exit(ring); }
+  } guard{&ring};
+
+  vector::Vector<Slot> slots(queue_depth);
+  size_t next = 0;
+  // Подготовленные, но ещё не отправленные запросы и запросы, ожидающие
+  // завершения в ядре
+  size_t queued = 0;
+  size_t in_kernel = 0;
+  auto submit = [&](size_t index) {
+    io_uring_sqe *sqe = io_uring_get_sqe(&ring);
+    const Slot &slot = slots[index];
+    if (Write) {
+      io_uring_prep_write(sqe, file.fd(), buffer + slot.offset,
+                          static_cast<unsigned>(slot.length), slot.offset);
+    } else {
+      io_uring_prep_read(sqe, file.fd(), buffer + slot.offset,
+                         static_cast<unsigned>(slot.length), slot.offset);
+    }
+    io_uring_sqe_set_data(sqe, reinterpret_cast<void *>(index));
+    ++queued;
+  };
+
+  for (size_t index = 0; index < queue_depth && next < length; ++index) {
+    slots[index] = Slot{next, std::min(request_size, length - next)};
+    next += slots[index].length;
+    submit(index);
+  }
+  try {
+    while (queued + in_kernel > 0) {
+      if (queued > 0) {
+        const int submitted = io_uring_submit(&ring);
+        if (submitted < 0) {
+          throw_errno(-submitted, "io_uring_submit " + file.path());
+        }
+        queued -= submitted;
+        in_kernel += submitted;
+      }
+      io_uring_cqe *cqe;
+      const int waited = io_uring_wait_cqe(&ring, &cqe);
+      if (waited < 0) {
+        if (waited == -EINTR) {
+          continue;
+        }
+        throw_errno(-waited, "io_uring_wait_cqe " + file.path());
+      }
+      const size_t index =
+          reinterpret_cast<size_t>(io_uring_cqe_get_data(cqe));
+      const int result = cqe->res;
+      io_uring_cqe_seen(&ring, cqe);
+      --in_kernel;
+
+      Slot &slot = slots[index];
+      if (result < 0 && result != -EINTR && result != -EAGAIN) {
+        throw_errno(-result, (Write ? "write " : "read ") + file.path());
+      }
+      if (result > 0) {
+        slot.offset += result;
+        slot.length -= std::min<size_t>(slot.length, result);
+      } else if (result == 0) {
+        if (slot.offset < end) {
+          throw std::runtime_error("Unexpected end of file " + file.path());
+        }
+        slot.length = 0;
+      }
+      if (slot.offset >= end) {
+        slot.length = 0;
+      }
+      if (slot.length == 0 && next < length) {
+        slot = Slot{next, std::min(request_size, length - next)};
+        next += slot.length;
+      }
+      if (slot.length > 0) {
+        submit(index);
+      }
+    }
+  } catch (...) {
+    // Ядро ещё пишет в buffer или читает из него: прежде чем кольцо будет
+    // закрыто, а вызывающий освободит буфер, дожидаемся всех отправленных
+    // запросов. Неотправленные остаются в кольце и ядро их не увидит
+    while (in_kernel > 0) {
+      io_uring_cqe *cqe;
+      const int waited = io_uring_wait_cqe(&ring, &cqe);
+      if (waited == -EINTR || waited == -EAGAIN) {
+        continue;
+      }
+      if (waited < 0) {
+        break;
+      }
+      io_uring_cqe_seen(&ring, cqe);
+      --in_kernel;
+    }
+    throw;
+  }
+  return true;
+}
+
+#endif
+
+// Передаёт length байт буфера начиная с нулевого смещения файла
+template <bool Write>
+void transfer_all(const File &file, char *buffer, size_t length, size_t end,
+                  const Options &options) {
+  size_t request_size =
+      std::clamp<size_t>(options.request_size, 1, kMaxRequestSize);
+  if (file.direct()) {
+    request_size = round_up(request_size, kDirectAlignment);
+  }
+  const size_t queue_depth = std::max<size_t>(options.queue_depth, 1);
+#if defined(CONTAINERS_HAVE_LIBURING) && defined(__linux__)
+  if (transfer_uring<Write>(file, buffer, length, end, request_size,
+                            queue_depth)) {
+    return;
+  }
+#endif
+  transfer_threads<Write>(file, buffer, length, end, request_size,
+                          queue_depth);
+}
+
+#endif // FILE_IO_POSIX
+
+template <size_t Alignment> void check_direct(const Options &options) {
+  if (options.direct && Alignment % kDirectAlignment != 0) {
+    throw std::invalid_argument(
+        "Direct I/O requires Vector<T, file_io::kDirectAlignment>");
+  }
+}
+
+} // namespace detail
+
+// Читает файл целиком в out, заменяя его содержимое. Буфер выделяется один
+// раз по размеру файла и заполняется крупными запросами без
+// поэлементных push_back. Размер файла должен быть кратен sizeof(T). При
+// ошибке чтения out остаётся пустым
+template <typename T, size_t Alignment>
+void load_file(const std::string &path, vector::Vector<T, Alignment> &out,
+               const Options &options = {}) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Only trivially copyable elements can be loaded bytewise");
+  detail::check_direct<Alignment>(options);
+#if defined(FILE_IO_POSIX)
+  const detail::File file(path, O_RDONLY, options.direct);
+  const size_t bytes = file.size();
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw std::system_error(errno, std::generic_category(), "open " + path);
+  }
+  const size_t bytes = static_cast<size_t>(file.tellg());
+  file.seekg(0);
+#endif
+  if (bytes % sizeof(T) != 0) {
+    throw std::runtime_error("File size is not a multiple of element size: " +
+                             path);
+  }
+  out.clear();
+#if defined(FILE_IO_POSIX)
+  // Запросы O_DIRECT выровнены, последний может читать за концом файла
+  const size_t length =
+      file.direct() ? detail::round_up(bytes, kDirectAlignment) : bytes;
+  out.reserve((length + sizeof(T) - 1) / sizeof(T));
+  out.resize_for_overwrite(bytes / sizeof(T));
+  try {
+    detail::transfer_all<false>(file, reinterpret_cast<char *>(out.data()),
+                                length, bytes, options);
+  } catch (...) {
+    // Не оставляем в out недочитанные элементы
+    out.clear();
+    throw;
+  }
+#else
+  out.resize_for_overwrite(bytes / sizeof(T));
+  if (!file.read(reinterpret_cast<char *>(out.data()), bytes)) {
+    out.clear();
+    throw std::runtime_error("Unexpected end of file " + path);
+  }
+#endif
+}
+
+template <typename T, size_t Alignment = alignof(T)>
+vector::Vector<T, Alignment> load_file(const std::string &path,
+                                       const Options &options = {}) {
+  vector::Vector<T, Alignment> result;
+  load_file(path, result, options);
+  return result;
+}
+
+// Записывает элементы values в файл, заменяя его содержимое
+template <typename T, size_t Alignment>
+void store_file(const std::string &path,
+                const vector::Vector<T, Alignment> &values,
+                const Options &options = {}) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Only trivially copyable elements can be stored bytewise");
+  detail::check_direct<Alignment>(options);
+  const size_t bytes = values.size() * sizeof(T);
+  char *buffer = reinterpret_cast<char *>(const_cast<T *>(values.data()));
+#if defined(FILE_IO_POSIX)
+  detail::File file(path, O_WRONLY | O_CREAT | O_TRUNC, options.direct);
+  // Файл сразу получает итоговый размер: параллельные запросы не
+  // расширяют его каждый по отдельности
+  file.resize(bytes);
+  const size_t aligned =
+      file.direct() ? bytes / kDirectAlignment * kDirectAlignment : bytes;
+  detail::transfer_all<true>(file, buffer, aligned, aligned, options);
+  if (aligned < bytes) {
+    file.drop_direct();
+    detail::transfer<true>(file, buffer + aligned, bytes - aligned, aligned,
+                           bytes);
+  }
+#else
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.write(buffer, bytes)) {
+    throw std::system_error(errno, std::generic_category(), "write " + path);
+  }
+#endif
+}
+
+} // end namespace file_io
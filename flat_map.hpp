@@ -0,0 +1,409 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace flat_map {
+
+namespace detail {
+
+// lower_bound без ветвлений в цикле: на каждом шаге половина диапазона
+// отбрасывается условным выбором, который компилятор превращает в cmov
+template <typename K, typename Key, typename Compare>
+size_t lower_bound(const K *keys, size_t size, const Key &key,
+                   const Compare &compare) {
+  if (size == 0) {
+    return 0;
+  }
+  const K *base = keys;
+  while (size > 1) {
+    const size_t half = size / 2;
+    base = compare(base[half], key) ? base + half : base;
+    size -= half;
+  }
+  return (base - keys) + (compare(*base, key) ? 1 : 0);
+}
+
+// Устойчивая сортировка пар по ключу: среди равных ключей первым остаётся
+// вхождение, встретившееся раньше
+template <typename Pair, typename Compare>
+void sort_by_key(vector::Vector<Pair> &pairs, const Compare &compare) {
+  std::stable_sort(pairs.begin(), pairs.end(),
+                   [&compare](const Pair &lhs, const Pair &rhs) {
+                     return compare(lhs.first, rhs.first);
+                   });
+}
+
+// Ссылка на элемент: пара ссылок на ключ и значение. Отдельный тип вместо
+// std::pair нужен, чтобы преобразование шло только в сторону value_type:
+// иначе у константного итератора нет общего ссылочного типа с value_type и
+// он не удовлетворяет концептам итераторов C++20
+template <typename K, typename Value>
+struct PairRef : std::pair<const K &, Value &> {
+  PairRef(const K &key, Value &value) noexcept
+      : std::pair<const K &, Value &>(key, value) {}
+};
+
+} // namespace detail
+
+// Упорядоченный ассоциативный массив на двух отсортированных Vector:
+// ключи и значения хранятся раздельно, поэтому поиск читает только ключи
+template <typename K, typename V, typename Compare = std::less<K>>
+class FlatMap {
+  template <bool IsConst> class BasicIterator {
+    friend class FlatMap;
+    using Owner = std::conditional_t<IsConst, const FlatMap, FlatMap>;
+    using Value = std::conditional_t<IsConst, const V, V>;
+
+    BasicIterator(Owner *owner, size_t index) noexcept
+        : owner_(owner), index_(index) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = std::pair<K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::PairRef<K, Value>;
+    using pointer = void;
+
+    BasicIterator() = default;
+
+    reference operator*() const noexcept {
+      return {owner_->keys_[index_], owner_->values_[index_]};
+    }
+
+    const K &key() const noexcept { return owner_->keys_[index_]; }
+    Value &value() const noexcept { return owner_->values_[index_]; }
+
+    BasicIterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    BasicIterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++index_;
+      return old_value;
+    }
+
+    bool operator==(const BasicIterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const BasicIterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+
+  private:
+    Owner *owner_ = nullptr;
+    size_t index_ = 0;
+  };
+
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+
+  FlatMap() = default;
+
+  // Построение из неотсортированного диапазона пар: одна сортировка и один
+  // проход, удаляющий повторы (сохраняется первое вхождение ключа)
+  template <typename InputIt> FlatMap(InputIt first, InputIt last) {
+    insert(first, last);
+  }
+
+  FlatMap(std::initializer_list<std::pair<K, V>> values)
+      : FlatMap(values.begin(), values.end()) {}
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, keys_.size()); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept {
+    return const_iterator(this, keys_.size());
+  }
+
+  size_t size() const noexcept { return keys_.size(); }
+  bool empty() const noexcept { return keys_.empty(); }
+
+  const vector::Vector<K> &keys() const noexcept { return keys_; }
+  const vector::Vector<V> &values() const noexcept { return values_; }
+
+  void reserve(size_t capacity) {
+    keys_.reserve(capacity);
+    values_.reserve(capacity);
+  }
+
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  template <typename Key> iterator lower_bound(const Key &key) {
+    return iterator(this, lower_bound_index(key));
+  }
+  template <typename Key> const_iterator lower_bound(const Key &key) const {
+    return const_iterator(this, lower_bound_index(key));
+  }
+
+  template <typename Key> iterator find(const Key &key) {
+    const size_t index = lower_bound_index(key);
+    return is_match(index, key) ? iterator(this, index) : end();
+  }
+  template <typename Key> const_iterator find(const Key &key) const {
+    const size_t index = lower_bound_index(key);
+    return is_match(index, key) ? const_iterator(this, index) : end();
+  }
+
+  template <typename Key> bool contains(const Key &key) const {
+    return is_match(lower_bound_index(key), key);
+  }
+
+  V &at(const K &key) {
+    const size_t index = lower_bound_index(key);
+    if (!is_match(index, key)) {
+      throw std::out_of_range("Key not found");
+    }
+    return values_[index];
+  }
+  const V &at(const K &key) const {
+    return const_cast<FlatMap &>(*this).at(key);
+  }
+
+  V &operator[](const K &key) { return try_emplace(key).first.value(); }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+    const size_t index = lower_bound_index(key);
+    if (is_match(index, key)) {
+      return {iterator(this, index), false};
+    }
+    keys_.insert(keys_.begin() + index, key);
+    try {
+      values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+    } catch (...) {
+      keys_.erase(keys_.begin() + index);
+      throw;
+    }
+    return {iterator(this, index), true};
+  }
+
+  std::pair<iterator, bool> insert(const std::pair<K, V> &value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  // Пакетная вставка: новые пары сортируются отдельно и сливаются с
+  // существующими с конца, так что каждый элемент сдвигается один раз
+  template <typename InputIt> void insert(InputIt first, InputIt last) {
+    vector::Vector<std::pair<K, V>> incoming;
+    for (; first != last; ++first) {
+      incoming.push_back(std::pair<K, V>(*first));
+    }
+    detail::sort_by_key(incoming, compare_);
+    merge(incoming);
+  }
+
+  size_t erase(const K &key) {
+    const size_t index = lower_bound_index(key);
+    if (!is_match(index, key)) {
+      return 0;
+    }
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+    return 1;
+  }
+
+private:
+  vector::Vector<K> keys_;
+  vector::Vector<V> values_;
+  Compare compare_;
+
+  template <typename Key> size_t lower_bound_index(const Key &key) const {
+    return detail::lower_bound(keys_.data(), keys_.size(), key, compare_);
+  }
+
+  template <typename Key> bool is_match(size_t index, const Key &key) const {
+    return index < keys_.size() && !compare_(key, keys_[index]);
+  }
+
+  void merge(vector::Vector<std::pair<K, V>> &incoming) {
+    // Первый проход: отбираем ключи, которых ещё нет в словаре; повторы во
+    // входных данных пропускаются, остаётся первое вхождение
+    vector::Vector<size_t> fresh;
+    size_t existing = 0;
+    for (size_t i = 0; i < incoming.size(); ++i) {
+      const K &key = incoming[i].first;
+      if (!fresh.empty() && !compare_(incoming[fresh[fresh.size() - 1]].first,
+                                      key)) {
+        continue;
+      }
+      while (existing < keys_.size() && compare_(keys_[existing], key)) {
+        ++existing;
+      }
+      if (existing < keys_.size() && !compare_(key, keys_[existing])) {
+        continue;
+      }
+      fresh.push_back(i);
+    }
+    if (fresh.empty()) {
+      return;
+    }
+
+    // Второй проход: слияние с конца в расширенные буферы. Память под оба
+    // массива выделяется заранее; если конструктор значения бросит, ключи
+    // откатываются к прежнему размеру и массивы остаются одной длины
+    size_t old_size = keys_.size();
+    size_t out = old_size + fresh.size();
+    keys_.reserve(out);
+    values_.reserve(out);
+    keys_.resize(out);
+    try {
+      values_.resize(out);
+    } catch (...) {
+      keys_.resize(old_size);
+      throw;
+    }
+    size_t next = fresh.size();
+    while (next > 0) {
+      std::pair<K, V> &candidate = incoming[fresh[next - 1]];
+      --out;
+      if (old_size > 0 && compare_(candidate.first, keys_[old_size - 1])) {
+        --old_size;
+        keys_[out] = std::move(keys_[old_size]);
+        values_[out] = std::move(values_[old_size]);
+      } else {
+        keys_[out] = std::move(candidate.first);
+        values_[out] = std::move(candidate.second);
+        --next;
+      }
+    }
+  }
+};
+
+// Упорядоченное множество на отсортированном Vector
+template <typename K, typename Compare = std::less<K>> class FlatSet {
+public:
+  using key_type = K;
+  using value_type = K;
+  using iterator = const K *;
+  using const_iterator = const K *;
+
+  FlatSet() = default;
+
+  template <typename InputIt> FlatSet(InputIt first, InputIt last) {
+    insert(first, last);
+  }
+
+  FlatSet(std::initializer_list<K> values)
+      : FlatSet(values.begin(), values.end()) {}
+
+  const_iterator begin() const noexcept { return keys_.begin(); }
+  const_iterator end() const noexcept { return keys_.end(); }
+
+  size_t size() const noexcept { return keys_.size(); }
+  bool empty() const noexcept { return keys_.empty(); }
+
+  void reserve(size_t capacity) { keys_.reserve(capacity); }
+  void clear() noexcept { keys_.clear(); }
+
+  template <typename Key> const_iterator lower_bound(const Key &key) const {
+    return begin() + lower_bound_index(key);
+  }
+
+  template <typename Key> const_iterator find(const Key &key) const {
+    const size_t index = lower_bound_index(key);
+    return is_match(index, key) ? begin() + index : end();
+  }
+
+  template <typename Key> bool contains(const Key &key) const {
+    return is_match(lower_bound_index(key), key);
+  }
+
+  std::pair<const_iterator, bool> insert(const K &key) {
+    const size_t index = lower_bound_index(key);
+    if (is_match(index, key)) {
+      return {begin() + index, false};
+    }
+    keys_.insert(keys_.begin() + index, key);
+    return {begin() + index, true};
+  }
+
+  // Пакетная вставка с однократным слиянием, см. FlatMap::insert
+  template <typename InputIt> void insert(InputIt first, InputIt last) {
+    vector::Vector<K> incoming;
+    for (; first != last; ++first) {
+      incoming.push_back(K(*first));
+    }
+    std::sort(incoming.begin(), incoming.end(), compare_);
+
+    vector::Vector<size_t> fresh;
+    size_t existing = 0;
+    for (size_t i = 0; i < incoming.size(); ++i) {
+      const K &key = incoming[i];
+      if (!fresh.empty() && !compare_(incoming[fresh[fresh.size() - 1]], key)) {
+        continue;
+      }
+      while (existing < keys_.size() && compare_(keys_[existing], key)) {
+        ++existing;
+      }
+      if (existing < keys_.size() && !compare_(key, keys_[existing])) {
+        continue;
+      }
+      fresh.push_back(i);
+    }
+
+    size_t old_size = keys_.size();
+    size_t out = old_size + fresh.size();
+    keys_.resize(out);
+    size_t next = fresh.size();
+    while (next > 0) {
+      K &candidate = incoming[fresh[next - 1]];
+      --out;
+      if (old_size > 0 && compare_(candidate, keys_[old_size - 1])) {
+        keys_[out] = std::move(keys_[--old_size]);
+      } else {
+        keys_[out] = std::move(candidate);
+        --next;
+      }
+    }
+  }
+
+  size_t erase(const K &key) {
+    const size_t index = lower_bound_index(key);
+    if (!is_match(index, key)) {
+      return 0;
+    }
+    keys_.erase(keys_.begin() + index);
+    return 1;
+  }
+
+private:
+  vector::Vector<K> keys_;
+  Compare compare_;
+
+  template <typename Key> size_t lower_bound_index(const Key &key) const {
+    return detail::lower_bound(keys_.data(), keys_.size(), key, compare_);
+  }
+
+  template <typename Key> bool is_match(size_t index, const Key &key) const {
+    return index < keys_.size() && !compare_(key, keys_[index]);
+  }
+};
+
+template <typename K, typename V, typename Compare>
+bool operator==(const FlatMap<K, V, Compare> &lhs,
+                const FlatMap<K, V, Compare> &rhs) {
+  return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+template <typename K, typename Compare>
+bool operator==(const FlatSet<K, Compare> &lhs,
+                const FlatSet<K, Compare> &rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+} // end namespace flat_map
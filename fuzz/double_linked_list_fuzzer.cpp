@@ -0,0 +1,11 @@
+// Дифференциальный фаззер DoubleLinkedList, см. list_fuzzer.hpp
+#include <cstdint>
+
+#include "list_fuzzer.hpp"
+#include "double_linked_list.hpp"
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, size_t size) {
+  fuzz::Input input(data, size);
+  fuzz::ListRunner<double_linked_list::DoubleLinkedList>::run(input);
+  return 0;
+}
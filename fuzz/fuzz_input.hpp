@@ -0,0 +1,109 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace fuzz {
+
+// Последовательное чтение входа фаззера. Когда байты кончаются, все
+// чтения возвращают нули
+class Input {
+public:
+  Input(const std::uint8_t *data, size_t size) noexcept
+      : data_(data), size_(size) {}
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  std::uint8_t byte() noexcept {
+    if (size_ == 0) {
+      return 0;
+    }
+    --size_;
+    return *data_++;
+  }
+
+  int value() noexcept {
+    return static_cast<int>(byte()) | static_cast<int>(byte()) << 8;
+  }
+
+  // Число из [0, bound]
+  size_t index(size_t bound) noexcept { return value() % (bound + 1); }
+
+private:
+  const std::uint8_t *data_;
+  size_t size_;
+};
+
+struct InjectedError : std::runtime_error {
+  InjectedError() : std::runtime_error("injected") {}
+};
+
+// Счётчики, общие для всех бросающих типов. live считает существующие
+// объекты, чтобы находить утечки и повторное разрушение
+struct ThrowingCounters {
+  static inline long live = 0;
+  static inline int countdown = -1;
+
+  // Бросить на n-й по счёту операции; отрицательное n — не бросать
+  static void arm(int n) noexcept { countdown = n; }
+
+  static void tick() {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw InjectedError();
+    }
+  }
+};
+
+// Элемент, копирование которого бросает InjectedError, когда обнулится
+// countdown. При MoveThrows бросает и перемещение, которое тогда не
+// объявлено noexcept
+template <bool MoveThrows> struct BasicThrowing : ThrowingCounters {
+  int value;
+
+  BasicThrowing() : BasicThrowing(0) {}
+  BasicThrowing(int v) : value(v) { ++live; }
+  BasicThrowing(const BasicThrowing &other) : value(other.value) {
+    tick();
+    ++live;
+  }
+  BasicThrowing(BasicThrowing &&other) noexcept(!MoveThrows)
+      : value(other.value) {
+    if constexpr (MoveThrows) {
+      tick();
+    }
+    ++live;
+  }
+  BasicThrowing &operator=(const BasicThrowing &other) {
+    tick();
+    value = other.value;
+    return *this;
+  }
+  BasicThrowing &operator=(BasicThrowing &&other) noexcept(!MoveThrows) {
+    if constexpr (MoveThrows) {
+      tick();
+    }
+    value = other.value;
+    return *this;
+  }
+  ~BasicThrowing() { --live; }
+
+  bool operator==(int other) const noexcept { return value == other; }
+};
+
+using Throwing = BasicThrowing<false>;
+using ThrowingMove = BasicThrowing<true>;
+
+// Проверка инварианта: при нарушении печатает место и аварийно завершает
+// процесс, что фаззер считает находкой
+inline void require(bool condition, const char *what, int line) {
+  if (!condition) {
+    std::fprintf(stderr, "fuzz invariant failed at line %d: %s\n", line, what);
+    std::abort();
+  }
+}
+
+#define FUZZ_REQUIRE(condition) ::fuzz::require((condition), #condition, __LINE__)
+
+} // end namespace fuzz
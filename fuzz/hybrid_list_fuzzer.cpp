@@ -0,0 +1,16 @@
+// Дифференциальный фаззер HybridList, см. list_fuzzer.hpp. Буфер уменьшен
+// до четырёх элементов, чтобы переход в связный режим случался часто
+#include <cstdint>
+
+#include "hybrid_list.hpp"
+#include "list_fuzzer.hpp"
+
+namespace {
+template <typename Type> using SmallHybridList = hybrid_list::HybridList<Type, 4>;
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, size_t size) {
+  fuzz::Input input(data, size);
+  fuzz::ListRunner<SmallHybridList>::run(input);
+  return 0;
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "fuzz_input.hpp"
+
+namespace fuzz {
+
+// Общий дифференциальный прогон для SingleLinkedList и DoubleLinkedList:
+// операции над двумя списками повторяются на std::vector<int>. Вставка и
+// копирование обещают строгую гарантию, поэтому после исключения из
+// копирования Throwing содержимое обязано совпасть с прежним. Число живых
+// Throwing сверяется с размерами списков: так видны утечки и повторное
+// разрушение элементов
+template <template <typename> class List> class ListRunner {
+public:
+  static void run(Input &input) {
+    run_lists(input);
+    FUZZ_REQUIRE(Throwing::live == 0);
+  }
+
+private:
+  static void run_lists(Input &input) {
+    List<Throwing> lists[2];
+    std::vector<int> expected[2];
+
+    while (!input.empty()) {
+      const std::uint8_t op = input.byte();
+      const size_t side = op & 1;
+      List<Throwing> &l = lists[side];
+      List<Throwing> &other = lists[side ^ 1];
+      std::vector<int> &e = expected[side];
+      std::vector<int> &other_e = expected[side ^ 1];
+      const int item = input.value();
+      Throwing::arm(input.byte() % 4 == 0 ? input.byte() % 4 : -1);
+
+      try {
+        switch ((op >> 1) % 13) {
+        case 0:
+          l.push_front(Throwing(item));
+          e.insert(e.begin(), item);
+          break;
+        case 1:
+          l.push_back(Throwing(item));
+          e.push_back(item);
+          break;
+        case 2: {
+          const size_t pos = input.index(e.size());
+          l.insert(before(l, pos), Throwing(item));
+          e.insert(e.begin() + pos, item);
+          break;
+        }
+        case 3:
+          if (!e.empty()) {
+            const size_t pos = input.index(e.size() - 1);
+            l.erase(before(l, pos));
+            e.erase(e.begin() + pos);
+          }
+          break;
+        case 4:
+          l.pop_front();
+          if (!e.empty()) {
+            e.erase(e.begin());
+          }
+          break;
+        case 5:
+          l.clear();
+          e.clear();
+          break;
+        case 6:
+          l = other;
+          e = other_e;
+          break;
+        case 7: {
+          List<Throwing> copy(other);
+          l = std::move(copy);
+          e = other_e;
+          break;
+        }
+        case 8:
+          l.swap(other);
+          e.swap(other_e);
+          break;
+        case 9:
+          l = std::move(other);
+          other.clear();
+          e = std::move(other_e);
+          other_e.clear();
+          break;
+        case 10:
+          if (!e.empty()) {
+            const size_t pos = input.index(e.size() - 1);
+            l[pos] = Throwing(item);
+            e[pos] = item;
+          }
+          break;
+        case 11: {
+          // Источник перемещения обязан остаться пригодным пустым списком
+          List<Throwing> moved(std::move(l));
+          other = std::move(moved);
+          other_e = std::move(e);
+          e.clear();
+          l.push_back(Throwing(item));
+          e.push_back(item);
+          break;
+        }
+        default: {
+          bool thrown = false;
+          try {
+            (void)l.at(e.size());
+          } catch (const std::out_of_range &) {
+            thrown = true;
+          }
+          FUZZ_REQUIRE(thrown);
+          break;
+        }
+        }
+      } catch (const InjectedError &) {
+      }
+      Throwing::arm(-1);
+
+      FUZZ_REQUIRE(same(lists[0], expected[0]));
+      FUZZ_REQUIRE(same(lists[1], expected[1]));
+      FUZZ_REQUIRE(Throwing::live ==
+                   static_cast<long>(lists[0].size() + lists[1].size()));
+    }
+  }
+
+  // Итератор на элемент, после которого стоит позиция index
+  static auto before(List<Throwing> &list, size_t index) {
+    auto it = list.cbefore_begin();
+    std::advance(it, index);
+    return it;
+  }
+
+  // Прямой обход, размер и push_back после обхода (он опирается на
+  // указатель на последний узел)
+  static bool same(List<Throwing> &list, const std::vector<int> &expected) {
+    if (list.size() != expected.size() ||
+        list.is_empty() != expected.empty()) {
+      return false;
+    }
+    size_t i = 0;
+    for (const Throwing &item : list) {
+      if (i == expected.size() || !(item == expected[i++])) {
+        return false;
+      }
+    }
+    if (i != expected.size()) {
+      return false;
+    }
+    list.push_back(Throwing(-1));
+    bool tail = list[expected.size()] == -1;
+    list.erase(before(list, expected.size()));
+    return tail && list.size() == expected.size();
+  }
+};
+
+} // end namespace fuzz
@@ -0,0 +1,11 @@
+// Дифференциальный фаззер SingleLinkedList, см. list_fuzzer.hpp
+#include <cstdint>
+
+#include "list_fuzzer.hpp"
+#include "single_linked_list.hpp"
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, size_t size) {
+  fuzz::Input input(data, size);
+  fuzz::ListRunner<single_linked_list::SingleLinkedList>::run(input);
+  return 0;
+}
@@ -0,0 +1,47 @@
+// Точка входа для сборки без libFuzzer (GCC). Понимает ту же командную
+// строку в упрощённом виде: файлы из аргументов проигрываются как входы,
+// затем выполняется -runs=N случайных входов длиной до -max_len байт,
+// начиная с -seed
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, size_t size);
+
+int main(int argc, char **argv) {
+  long runs = 1000;
+  size_t max_len = 4096;
+  unsigned long seed = 1;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], "-runs=", 6) == 0) {
+      runs = std::strtol(argv[i] + 6, nullptr, 10);
+    } else if (std::strncmp(argv[i], "-max_len=", 9) == 0) {
+      max_len = std::strtoul(argv[i] + 9, nullptr, 10);
+    } else if (std::strncmp(argv[i], "-seed=", 6) == 0) {
+      seed = std::strtoul(argv[i] + 6, nullptr, 10);
+    } else if (argv[i][0] != '-') {
+      std::ifstream file(argv[i], std::ios::binary);
+      const std::vector<char> bytes((std::istreambuf_iterator<char>(file)),
+                                    std::istreambuf_iterator<char>());
+      LLVMFuzzerTestOneInput(
+          reinterpret_cast<const std::uint8_t *>(bytes.data()), bytes.size());
+    }
+  }
+
+  std::mt19937_64 random(seed);
+  std::vector<std::uint8_t> input;
+  for (long run = 0; run < runs; ++run) {
+    input.resize(random() % (max_len + 1));
+    for (std::uint8_t &byte : input) {
+      byte = static_cast<std::uint8_t>(random());
+    }
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+  }
+  std::printf("Done %ld runs\n", runs);
+  return 0;
+}
@@ -0,0 +1,197 @@
+// Дифференциальный фаззер Vector: случайная последовательность операций над
+// двумя векторами повторяется на std::vector<int>, после каждой операции
+// содержимое сравнивается. Элементы — int (побайтовые пути), Throwing,
+// копирование которого бросает в случайный момент, или ThrowingMove, у
+// которого бросает и перемещение. Операции со строгой гарантией после
+// исключения обязаны оставить оба вектора прежними
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fuzz_input.hpp"
+#include "vector.hpp"
+
+namespace {
+
+using fuzz::Input;
+using fuzz::Throwing;
+using fuzz::ThrowingCounters;
+using fuzz::ThrowingMove;
+
+template <typename T>
+bool same(const vector::Vector<T> &values, const std::vector<int> &expected) {
+  if (values.size() != expected.size() || values.capacity() < values.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (!(values[i] == expected[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void resync(const vector::Vector<T> &values, std::vector<int> &expected) {
+  expected.clear();
+  for (const T &item : values) {
+    if constexpr (std::is_same_v<T, int>) {
+      expected.push_back(item);
+    } else {
+      expected.push_back(item.value);
+    }
+  }
+}
+
+template <typename T> void run(Input &input) {
+  vector::Vector<T> values[2];
+  std::vector<int> expected[2];
+
+  while (!input.empty()) {
+    const std::uint8_t op = input.byte();
+    const size_t side = op & 1;
+    vector::Vector<T> &v = values[side];
+    vector::Vector<T> &other = values[side ^ 1];
+    std::vector<int> &e = expected[side];
+    std::vector<int> &other_e = expected[side ^ 1];
+    const int item = input.value();
+    ThrowingCounters::arm(input.byte() % 4 == 0 ? input.byte() % 4 : -1);
+    bool strong = true;
+
+    try {
+      switch ((op >> 1) % 16) {
+      case 0: {
+        const T copy(item);
+        v.push_back(copy);
+        e.push_back(item);
+        break;
+      }
+      case 1:
+        v.push_back(T(item));
+        e.push_back(item);
+        break;
+      case 2:
+        v.emplace_back(item);
+        e.push_back(item);
+        break;
+      case 3: {
+        const size_t pos = input.index(v.size());
+        strong = pos == v.size() || std::is_nothrow_move_assignable_v<T>;
+        const T copy(item);
+        v.insert(v.begin() + pos, copy);
+        e.insert(e.begin() + pos, item);
+        break;
+      }
+      case 4:
+        strong = std::is_nothrow_move_assignable_v<T>;
+        if (!v.empty()) {
+          const size_t pos = input.index(v.size() - 1);
+          v.erase(v.begin() + pos);
+          e.erase(e.begin() + pos);
+        }
+        break;
+      case 5:
+        v.pop_back();
+        if (!e.empty()) {
+          e.pop_back();
+        }
+        break;
+      case 6: {
+        const size_t size = input.index(64);
+        v.resize(size);
+        e.resize(size);
+        break;
+      }
+      case 7:
+        v.reserve(input.index(128));
+        break;
+      case 8:
+        v.shrink_to_fit();
+        break;
+      case 9:
+        v.clear();
+        e.clear();
+        break;
+      case 10:
+        strong = false;
+        v = other;
+        e = other_e;
+        break;
+      case 11: {
+        vector::Vector<T> copy(other);
+        v = std::move(copy);
+        e = other_e;
+        break;
+      }
+      case 12:
+        v.swap(other);
+        e.swap(other_e);
+        break;
+      case 13:
+        if (!v.empty()) {
+          const size_t pos = input.index(v.size() - 1);
+          v[pos] = T(item);
+          e[pos] = item;
+        }
+        break;
+      case 14:
+        v = std::move(other);
+        other.clear();
+        e = std::move(other_e);
+        other_e.clear();
+        break;
+      default:
+        v.set_shrink_ratio(input.byte() % 5);
+        v.clear_and_release();
+        e.clear();
+        break;
+      }
+    } catch (const fuzz::InjectedError &) {
+      ThrowingCounters::arm(-1);
+      if (strong) {
+        FUZZ_REQUIRE(same(values[0], expected[0]));
+        FUZZ_REQUIRE(same(values[1], expected[1]));
+      }
+      // Базовая гарантия: контейнеры остаются согласованными, но
+      // содержимое могло измениться
+      resync(values[0], expected[0]);
+      resync(values[1], expected[1]);
+    }
+    ThrowingCounters::arm(-1);
+
+    FUZZ_REQUIRE(same(values[0], expected[0]));
+    FUZZ_REQUIRE(same(values[1], expected[1]));
+    if constexpr (!std::is_same_v<T, int>) {
+      FUZZ_REQUIRE(ThrowingCounters::live ==
+                   static_cast<long>(values[0].size() + values[1].size()));
+    }
+    bool thrown = false;
+    try {
+      (void)v.at(v.size());
+    } catch (const std::out_of_range &) {
+      thrown = true;
+    }
+    FUZZ_REQUIRE(thrown);
+  }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, size_t size) {
+  Input input(data, size);
+  switch (input.byte() % 3) {
+  case 0:
+    run<int>(input);
+    break;
+  case 1:
+    run<Throwing>(input);
+    break;
+  default:
+    run<ThrowingMove>(input);
+    break;
+  }
+  FUZZ_REQUIRE(ThrowingCounters::live == 0);
+  return 0;
+}
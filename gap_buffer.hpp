@@ -0,0 +1,359 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace gap_buffer {
+
+// Буфер с разрывом: элементы лежат в [0, gap_begin_) и [gap_end_, capacity),
+// между ними — неинициализированный разрыв. Вставка и удаление рядом с
+// разрывом стоят O(1), переход к другой позиции — O(расстояние)
+template <typename T> class GapBuffer {
+  template <typename ValueType> class BasicIterator {
+    friend class GapBuffer;
+    template <typename> friend class BasicIterator;
+    using Owner = std::conditional_t<std::is_const_v<ValueType>,
+                                     const GapBuffer, GapBuffer>;
+
+    BasicIterator(Owner *owner, size_t index) noexcept
+        : owner_(owner), index_(index) {}
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    BasicIterator(const BasicIterator<T> &other) noexcept
+        : owner_(other.owner_), index_(other.index_) {}
+
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+    pointer operator->() const noexcept { return &(*owner_)[index_]; }
+    reference operator[](difference_type n) const noexcept {
+      return (*owner_)[index_ + n];
+    }
+
+    BasicIterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    BasicIterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++index_;
+      return old_value;
+    }
+    BasicIterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    BasicIterator operator--(int) noexcept {
+      auto old_value(*this);
+      --index_;
+      return old_value;
+    }
+    BasicIterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    BasicIterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    BasicIterator operator+(difference_type n) const noexcept {
+      return BasicIterator(owner_, index_ + n);
+    }
+    friend BasicIterator operator+(difference_type n,
+                                   const BasicIterator &it) noexcept {
+      return it + n;
+    }
+    BasicIterator operator-(difference_type n) const noexcept {
+      return BasicIterator(owner_, index_ - n);
+    }
+    difference_type operator-(const BasicIterator &rhs) const noexcept {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(rhs.index_);
+    }
+
+    bool operator==(const BasicIterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const BasicIterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+    bool operator<(const BasicIterator &rhs) const noexcept {
+      return index_ < rhs.index_;
+    }
+    bool operator>(const BasicIterator &rhs) const noexcept {
+      return index_ > rhs.index_;
+    }
+    bool operator<=(const BasicIterator &rhs) const noexcept {
+      return index_ <= rhs.index_;
+    }
+    bool operator>=(const BasicIterator &rhs) const noexcept {
+      return index_ >= rhs.index_;
+    }
+
+  private:
+    Owner *owner_ = nullptr;
+    size_t index_ = 0;
+  };
+
+public:
+  using value_type = T;
+  using iterator = BasicIterator<T>;
+  using const_iterator = BasicIterator<const T>;
+
+  GapBuffer() = default;
+
+  explicit GapBuffer(size_t size) : data_(size), gap_begin_(size),
+                                    gap_end_(size) {
+    std::uninitialized_value_construct_n(data_.get_address(), size);
+  }
+
+  GapBuffer(std::initializer_list<T> values)
+      : data_(values.size()), gap_begin_(values.size()),
+        gap_end_(values.size()) {
+    std::uninitialized_copy(values.begin(), values.end(), data_.get_address());
+  }
+
+  GapBuffer(const GapBuffer &other)
+      : data_(other.size()), gap_begin_(other.size()),
+        gap_end_(other.size()) {
+    T *tail = std::uninitialized_copy_n(other.data_.get_address(),
+                                        other.gap_begin_, data_.get_address());
+    try {
+      std::uninitialized_copy_n(other.data_.get_address() + other.gap_end_,
+                                other.data_.capacity() - other.gap_end_, tail);
+    } catch (...) {
+      std::destroy_n(data_.get_address(), other.gap_begin_);
+      throw;
+    }
+  }
+
+  GapBuffer(GapBuffer &&other) noexcept { swap(other); }
+
+  GapBuffer &operator=(const GapBuffer &rhs) {
+    if (this != &rhs) {
+      GapBuffer copy(rhs);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  GapBuffer &operator=(GapBuffer &&rhs) noexcept {
+    swap(rhs);
+    return *this;
+  }
+
+  ~GapBuffer() { destroy_elements(); }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cend() const noexcept {
+    return const_iterator(this, size());
+  }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+
+  size_t size() const noexcept {
+    return data_.capacity() - (gap_end_ - gap_begin_);
+  }
+  bool empty() const noexcept { return size() == 0; }
+  size_t capacity() const noexcept { return data_.capacity(); }
+  // Позиция разрыва: сюда вставка выполняется без сдвига элементов
+  size_t cursor() const noexcept { return gap_begin_; }
+
+  T &operator[](size_t index) noexcept {
+    return data_.get_address()[index < gap_begin_
+                                   ? index
+                                   : index + (gap_end_ - gap_begin_)];
+  }
+  const T &operator[](size_t index) const noexcept {
+    return const_cast<GapBuffer &>(*this)[index];
+  }
+
+  void swap(GapBuffer &other) noexcept {
+    data_.swap(other.data_);
+    std::swap(gap_begin_, other.gap_begin_);
+    std::swap(gap_end_, other.gap_end_);
+  }
+
+  void reserve(size_t new_capacity) {
+    if (new_capacity > data_.capacity()) {
+      reallocate(new_capacity);
+    }
+  }
+
+  // Переносит разрыв в позицию index, сдвигая только элементы между старой и
+  // новой позицией
+  void move_gap(size_t index) {
+    if (index > size()) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    if (gap_begin_ == gap_end_) {
+      gap_begin_ = gap_end_ = index;
+      return;
+    }
+    T *buffer = data_.get_address();
+    if (index < gap_begin_) {
+      const size_t count = gap_begin_ - index;
+      relocate_backward(buffer + index, count, buffer + gap_end_ - count);
+      gap_begin_ -= count;
+      gap_end_ -= count;
+    } else if (index > gap_begin_) {
+      const size_t count = index - gap_begin_;
+      relocate_forward(buffer + gap_end_, count, buffer + gap_begin_);
+      gap_begin_ += count;
+      gap_end_ += count;
+    }
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    const size_t position = pos.index_;
+    // Аргументы могут ссылаться на элементы буфера, поэтому значение
+    // создаётся до переноса разрыва
+    T value(std::forward<Args>(args)...);
+    if (gap_begin_ == gap_end_) {
+      reallocate(data_.capacity() == 0 ? 16 : data_.capacity() * 2);
+    }
+    move_gap(position);
+    new (data_.get_address() + gap_begin_) T(std::move(value));
+    ++gap_begin_;
+    return iterator(this, position);
+  }
+
+  iterator insert(const_iterator pos, const T &item) {
+    return emplace(pos, item);
+  }
+  iterator insert(const_iterator pos, T &&item) {
+    return emplace(pos, std::move(item));
+  }
+
+  template <typename InputIt>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    const size_t position = pos.index_;
+    move_gap(position);
+    for (; first != last; ++first) {
+      if (gap_begin_ == gap_end_) {
+        reallocate(data_.capacity() == 0 ? 16 : data_.capacity() * 2);
+      }
+      new (data_.get_address() + gap_begin_) T(*first);
+      ++gap_begin_;
+    }
+    return iterator(this, position);
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  // Удаление диапазона: разрыв переносится в first и поглощает элементы
+  iterator erase(const_iterator first, const_iterator last) {
+    if (first.index_ > last.index_ || last.index_ > size()) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    const size_t count = last.index_ - first.index_;
+    move_gap(first.index_);
+    std::destroy_n(data_.get_address() + gap_end_, count);
+    gap_end_ += count;
+    return iterator(this, first.index_);
+  }
+
+  void push_back(const T &value) { emplace(cend(), value); }
+  void push_back(T &&value) { emplace(cend(), std::move(value)); }
+
+  void pop_back() {
+    if (!empty()) {
+      erase(cend() - 1);
+    }
+  }
+
+  void clear() noexcept {
+    destroy_elements();
+    gap_begin_ = 0;
+    gap_end_ = data_.capacity();
+  }
+
+private:
+  vector::RawMemory<T> data_;
+  size_t gap_begin_ = 0;
+  size_t gap_end_ = 0;
+
+  void destroy_elements() noexcept {
+    std::destroy_n(data_.get_address(), gap_begin_);
+    std::destroy_n(data_.get_address() + gap_end_,
+                   data_.capacity() - gap_end_);
+  }
+
+  // Переносит count элементов из from в to (to > from), начиная с конца,
+  // чтобы не затереть ещё не перенесённые элементы
+  static void relocate_backward(T *from, size_t count, T *to) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memmove(static_cast<void *>(to), from, count * sizeof(T));
+    } else {
+      for (size_t i = count; i-- > 0;) {
+        new (to + i) T(std::move(from[i]));
+        std::destroy_at(from + i);
+      }
+    }
+  }
+
+  // Переносит count элементов из from в to (to < from), начиная с начала
+  static void relocate_forward(T *from, size_t count, T *to) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memmove(static_cast<void *>(to), from, count * sizeof(T));
+    } else {
+      for (size_t i = 0; i < count; ++i) {
+        new (to + i) T(std::move(from[i]));
+        std::destroy_at(from + i);
+      }
+    }
+  }
+
+  // Новый буфер того же содержания, разрыв остаётся на месте и расширяется
+  void reallocate(size_t new_capacity) {
+    vector::RawMemory<T> new_data(new_capacity);
+    const size_t tail = data_.capacity() - gap_end_;
+    const size_t new_gap_end = new_capacity - tail;
+    T *buffer = data_.get_address();
+    T *new_buffer = new_data.get_address();
+    if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                  !std::is_copy_constructible_v<T>) {
+      std::uninitialized_move_n(buffer, gap_begin_, new_buffer);
+      std::uninitialized_move_n(buffer + gap_end_, tail,
+                                new_buffer + new_gap_end);
+    } else {
+      std::uninitialized_copy_n(buffer, gap_begin_, new_buffer);
+      try {
+        std::uninitialized_copy_n(buffer + gap_end_, tail,
+                                  new_buffer + new_gap_end);
+      } catch (...) {
+        std::destroy_n(new_buffer, gap_begin_);
+        throw;
+      }
+    }
+    destroy_elements();
+    data_.swap(new_data);
+    gap_end_ = new_gap_end;
+  }
+};
+
+template <typename T>
+bool operator==(const GapBuffer<T> &lhs, const GapBuffer<T> &rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+} // end namespace gap_buffer
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "chunked_deque.hpp"
+
+using SmallBlockDeque = chunked_deque::ChunkedDeque<int, 4>;
+
+// 1 Вставка элементов в конец и в начало
+TEST(chunked_deque, push_back_front) {
+  SmallBlockDeque deque;
+  for (int i = 1; i <= 10; ++i) {
+    deque.push_back(i);
+  }
+  for (int i = 0; i >= -10; --i) {
+    deque.push_front(i);
+  }
+  ASSERT_TRUE(deque.size() == 21);
+  for (int i = 0; i < 21; ++i) {
+    ASSERT_TRUE(deque[i] == i - 10);
+  }
+  ASSERT_TRUE(deque.front() == -10);
+  ASSERT_TRUE(deque.back() == 10);
+}
+
+// 2 Удаление элементов с обоих концов
+TEST(chunked_deque, pop_back_front) {
+  SmallBlockDeque deque = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  deque.pop_front();
+  deque.pop_front();
+  deque.pop_back();
+  ASSERT_TRUE(deque.size() == 6);
+  ASSERT_TRUE(deque.front() == 3);
+  ASSERT_TRUE(deque.back() == 8);
+  while (!deque.empty()) {
+    deque.pop_front();
+  }
+  deque.push_back(42);
+  ASSERT_TRUE(deque.front() == 42);
+}
+
+// 3 Ссылки на элементы не инвалидируются при росте
+TEST(chunked_deque, stable_references) {
+  SmallBlockDeque deque;
+  deque.push_back(1);
+  int *first = &deque.front();
+  for (int i = 0; i < 1000; ++i) {
+    deque.push_back(i);
+    deque.push_front(i);
+  }
+  ASSERT_TRUE(first == &deque[1000]);
+  ASSERT_TRUE(*first == 1);
+}
+
+// 4 Очередь: элементы проходят через дек, не накапливая блоки
+TEST(chunked_deque, fifo) {
+  SmallBlockDeque deque;
+  int expected = 0;
+  for (int i = 0; i < 1000; ++i) {
+    deque.push_back(i);
+    if (i % 3 == 2) {
+      ASSERT_TRUE(deque.front() == expected++);
+      deque.pop_front();
+    }
+  }
+  ASSERT_TRUE(deque.size() == static_cast<size_t>(1000 - expected));
+  ASSERT_TRUE(deque.front() == expected);
+}
+
+// 5 Итераторы произвольного доступа
+TEST(chunked_deque, iterators) {
+  SmallBlockDeque deque = {5, 3, 9, 1, 7, 2, 8};
+  std::sort(deque.begin(), deque.end());
+  ASSERT_TRUE(std::is_sorted(deque.begin(), deque.end()));
+  ASSERT_TRUE(deque.end() - deque.begin() == 7);
+  ASSERT_TRUE(*(deque.begin() + 3) == 5);
+}
+
+// 6 Копирование, перемещение и удаление контейнера
+TEST(chunked_deque, copy_move_destroy) {
+  static int counter = 0;
+  struct Helper {
+    ~Helper() { ++counter; }
+  };
+  {
+    chunked_deque::ChunkedDeque<std::string, 4> deque = {"a", "b", "c",
+                                                          "d", "e"};
+    chunked_deque::ChunkedDeque<std::string, 4> copy = deque;
+    ASSERT_TRUE(copy == deque);
+    chunked_deque::ChunkedDeque<std::string, 4> moved = std::move(copy);
+    ASSERT_TRUE(moved == deque);
+    ASSERT_TRUE(copy.empty());
+  }
+  {
+    chunked_deque::ChunkedDeque<Helper, 4> deque;
+    for (int i = 0; i < 10; ++i) {
+      deque.emplace_back();
+    }
+    counter = 0;
+  }
+  ASSERT_TRUE(counter == 10);
+}
+
+namespace {
+// Считает живые объекты; копирование бросает, когда исчерпан счётчик
+struct Tracked {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+
+  Tracked() { ++live; }
+  Tracked(const Tracked &) {
+    if (copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+    --copies_left;
+    ++live;
+  }
+  ~Tracked() { --live; }
+};
+} // namespace
+
+// 7 Исключение при копировании освобождает уже скопированные элементы
+TEST(chunked_deque, copy_exception) {
+  Tracked::live = 0;
+  {
+    using TrackedDeque = chunked_deque::ChunkedDeque<Tracked, 4>;
+    TrackedDeque deque;
+    for (int i = 0; i < 6; ++i) {
+      deque.emplace_back();
+    }
+    Tracked::copies_left = 5;
+    ASSERT_THROW(TrackedDeque copy(deque), std::runtime_error);
+    Tracked::copies_left = 2;
+    ASSERT_THROW((TrackedDeque{deque[0], deque[1], deque[2]}),
+                 std::runtime_error);
+    Tracked::copies_left = -1;
+    ASSERT_TRUE(Tracked::live == 6);
+  }
+  ASSERT_TRUE(Tracked::live == 0);
+}
+
+// 8 Неудачный emplace_front не оставляет пустой головной блок
+TEST(chunked_deque, emplace_front_exception) {
+  Tracked::live = 0;
+  chunked_deque::ChunkedDeque<Tracked, 4> deque;
+  for (int i = 0; i < 4; ++i) {
+    deque.emplace_back();
+  }
+  const size_t usage = deque.memory_usage();
+  Tracked::copies_left = 0;
+  ASSERT_THROW(deque.push_front(deque.back()), std::runtime_error);
+  Tracked::copies_left = -1;
+  ASSERT_TRUE(deque.size() == 4);
+  while (!deque.empty()) {
+    deque.pop_front();
+  }
+  ASSERT_TRUE(deque.memory_usage() < usage);
+  ASSERT_TRUE(Tracked::live == 0);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "coroutine.hpp"
+#include "single_linked_list.hpp"
+#include "vector.hpp"
+
+namespace {
+
+coroutine::Generator<int> iota(int count) {
+  for (int i = 0; i < count; ++i) {
+    co_yield i;
+  }
+}
+
+coroutine::Generator<int> failing(int count) {
+  for (int i = 0; i < count; ++i) {
+    co_yield i;
+  }
+  throw std::runtime_error("source failed");
+}
+
+} // namespace
+
+// 1 Генератор вычисляет элементы по мере обхода
+TEST(coroutine, generator) {
+  int sum = 0;
+  for (int value : iota(5)) {
+    sum += value;
+  }
+  ASSERT_TRUE(sum == 10);
+
+  auto generator = iota(1000000);
+  auto it = generator.begin();
+  ++it;
+  ++it;
+  ASSERT_TRUE(*it == 2);
+
+  auto empty = iota(0);
+  ASSERT_TRUE(empty.begin() == empty.end());
+}
+
+// 2 Конвейер генератор → канал → Vector в пуле из одного потока
+TEST(coroutine, collect_into_vector) {
+  parallel::ThreadPool pool(1);
+  parallel::TaskGroup group(pool);
+  coroutine::AsyncChannel<int> channel(2);
+  vector::Vector<int> values;
+  auto producer = coroutine::pump(iota(1000), channel, 64);
+  auto consumer = coroutine::collect(channel, values);
+  producer.start(group);
+  consumer.start(group);
+  group.wait();
+  ASSERT_TRUE(producer.done() && consumer.done());
+  ASSERT_TRUE(values.size() == 1000);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(values[i] == i);
+  }
+}
+
+// 3 Отправитель ждёт, пока в канале capacity пакетов
+TEST(coroutine, backpressure) {
+  parallel::ThreadPool pool(4);
+  parallel::TaskGroup group(pool);
+  coroutine::AsyncChannel<int> channel(3);
+  std::atomic<size_t> max_size{0};
+  size_t batches = 0;
+  auto producer = coroutine::pump(iota(10000), channel, 10);
+  auto consumer = coroutine::consume(channel, [&](vector::Vector<int> batch) {
+    size_t size = channel.size();
+    if (size > max_size) {
+      max_size = size;
+    }
+    batches += batch.size() == 10;
+  });
+  consumer.start(group);
+  producer.start(group);
+  group.wait();
+  ASSERT_TRUE(batches == 1000);
+  ASSERT_TRUE(max_size <= channel.capacity());
+}
+
+// 4 Сбор в SingleLinkedList с сохранением порядка
+TEST(coroutine, collect_into_list) {
+  parallel::ThreadPool pool(4);
+  parallel::TaskGroup group(pool);
+  coroutine::AsyncChannel<int> channel;
+  single_linked_list::SingleLinkedList<int> list;
+  auto consumer = coroutine::collect(channel, list);
+  auto producer = coroutine::pump(iota(100000), channel, 256);
+  consumer.start(group);
+  producer.start(group);
+  group.wait();
+  ASSERT_TRUE(list.size() == 100000);
+  int expected = 0;
+  for (int value : list) {
+    ASSERT_TRUE(value == expected++);
+  }
+}
+
+// 5 Исключение источника закрывает канал и пробрасывается из wait
+TEST(coroutine, producer_exception) {
+  parallel::ThreadPool pool(2);
+  parallel::TaskGroup group(pool);
+  coroutine::AsyncChannel<int> channel(1);
+  vector::Vector<int> values;
+  auto producer = coroutine::pump(failing(100), channel, 8);
+  auto consumer = coroutine::collect(channel, values);
+  producer.start(group);
+  consumer.start(group);
+  ASSERT_THROW(group.wait(), std::runtime_error);
+  ASSERT_TRUE(consumer.done());
+  ASSERT_TRUE(values.size() == 96);
+}
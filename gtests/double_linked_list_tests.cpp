@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "double_linked_list.hpp"
 
 // 1 Создание контейнера
@@ -152,3 +158,126 @@ TEST(double_linked_list, clear) {
   double_linked_list2.clear();
   ASSERT_TRUE(double_linked_list1 == double_linked_list2);
 }
+
+TEST(double_linked_list, memory_usage) {
+  double_linked_list::DoubleLinkedList<int> double_linked_list1;
+  const size_t empty_usage = double_linked_list1.memory_usage();
+  double_linked_list1.push_back(1);
+  double_linked_list1.push_back(2);
+  ASSERT_TRUE(double_linked_list1.memory_usage() >=
+              empty_usage + 2 * (sizeof(int) + 2 * sizeof(void *)));
+  double_linked_list1.clear();
+  ASSERT_TRUE(double_linked_list1.memory_usage() == empty_usage);
+}
+
+TEST(double_linked_list, for_each) {
+  double_linked_list::DoubleLinkedList<int> double_linked_list1 = {1, 2, 3};
+  double_linked_list1.for_each([](int &value) { value *= 10; });
+  ASSERT_TRUE(double_linked_list1[2] == 30);
+  const int sum = double_linked_list1.transform_reduce(
+      0, [](int lhs, int rhs) { return lhs + rhs; },
+      [](int value) { return value / 10; });
+  ASSERT_TRUE(sum == 6);
+}
+
+TEST(double_linked_list, for_each_interleaved) {
+  double_linked_list::DoubleLinkedList<int> double_linked_list1 = {1, 2};
+  double_linked_list::DoubleLinkedList<int> double_linked_list2 = {10, 20, 30};
+  std::vector<std::pair<size_t, int>> visited;
+  double_linked_list::DoubleLinkedList<int>::for_each_interleaved(
+      [&](size_t list, int value) { visited.emplace_back(list, value); },
+      double_linked_list1, double_linked_list2);
+  const std::vector<std::pair<size_t, int>> expected = {
+      {0, 1}, {1, 10}, {0, 2}, {1, 20}, {1, 30}};
+  ASSERT_TRUE(visited == expected);
+}
+
+TEST(double_linked_list, compact) {
+  double_linked_list::DoubleLinkedList<std::string> double_linked_list1;
+  for (int i = 0; i < 100; ++i) {
+    double_linked_list1.push_back(std::to_string(i));
+    double_linked_list1.push_front(std::to_string(-i));
+  }
+  for (int i = 0; i < 50; ++i) {
+    double_linked_list1.erase(double_linked_list1.begin());
+  }
+  const double_linked_list::DoubleLinkedList<std::string> expected(
+      double_linked_list1);
+  double_linked_list1.compact();
+  ASSERT_TRUE(double_linked_list1 == expected);
+
+  // Узлы лежат подряд с постоянным шагом, обратные ссылки согласованы
+  auto address = [](const std::string &value) {
+    return reinterpret_cast<std::uintptr_t>(&value);
+  };
+  auto it = double_linked_list1.begin();
+  const auto stride = address(*std::next(it)) - address(*it);
+  for (size_t i = 1; i < double_linked_list1.size(); ++i) {
+    auto next = std::next(it);
+    ASSERT_TRUE(address(*next) - address(*it) == stride);
+    ASSERT_TRUE(std::prev(next) == it);
+    it = next;
+  }
+  double_linked_list1.push_back("tail");
+  ASSERT_TRUE(double_linked_list1[double_linked_list1.size() - 1] == "tail");
+}
+
+TEST(double_linked_list, compact_step) {
+  double_linked_list::DoubleLinkedList<int> double_linked_list1;
+  for (int i = 0; i < 100; ++i) {
+    double_linked_list1.push_back(i);
+  }
+  ASSERT_FALSE(double_linked_list1.compact_step(10));
+  // Изменения между шагами: удаление узла в позиции прохода и вставка
+  // после неё
+  double_linked_list1.erase(std::next(double_linked_list1.begin(), 9));
+  double_linked_list1.push_back(100);
+  size_t steps = 1;
+  for (bool done = false; !done; ++steps) {
+    done = double_linked_list1.compact_step(10);
+  }
+  ASSERT_TRUE(steps == 10);
+  ASSERT_TRUE(double_linked_list1.size() == 100);
+  ASSERT_TRUE(double_linked_list1[9] == 9);
+  ASSERT_TRUE(double_linked_list1[10] == 11);
+  ASSERT_TRUE(double_linked_list1[99] == 100);
+  ASSERT_TRUE(double_linked_list1.memory_usage() >=
+              sizeof(double_linked_list1) + 100 * sizeof(int));
+  double_linked_list1.clear();
+  ASSERT_TRUE(double_linked_list1.is_empty());
+}
+
+TEST(double_linked_list, reverse_iteration) {
+  double_linked_list::DoubleLinkedList<int> double_linked_list1 = {1, 2, 3};
+  const std::vector<int> reversed(
+      std::make_reverse_iterator(double_linked_list1.end()),
+      std::make_reverse_iterator(double_linked_list1.begin()));
+  ASSERT_TRUE(reversed == std::vector<int>({3, 2, 1}));
+  double_linked_list1.push_back(4);
+  ASSERT_TRUE(*std::prev(double_linked_list1.cend()) == 4);
+}
+
+TEST(double_linked_list, checked_access) {
+  double_linked_list::DoubleLinkedList<int> double_linked_list1 = {1, 2, 3};
+  ASSERT_TRUE(double_linked_list1[2] == 3);
+  ASSERT_TRUE(double_linked_list1.at(0) == 1);
+  ASSERT_THROW(double_linked_list1.at(3), std::out_of_range);
+}
+
+TEST(double_linked_list, reuse_moved_from) {
+  double_linked_list::DoubleLinkedList<std::string> source = {"a", "b"};
+  double_linked_list::DoubleLinkedList<std::string> target(std::move(source));
+  ASSERT_TRUE(source.is_empty());
+  ASSERT_TRUE(source.begin() == source.end());
+  source.push_back("c");
+  source.push_front("b");
+  ASSERT_TRUE(*std::prev(source.end()) == "c");
+  std::vector<std::string> values(source.begin(), source.end());
+  ASSERT_TRUE((values == std::vector<std::string>{"b", "c"}));
+
+  target = std::move(source);
+  source.clear();
+  source.push_back("d");
+  ASSERT_TRUE(source.size() == 1 && *source.begin() == "d");
+  ASSERT_TRUE(target.size() == 2 && *std::prev(target.end()) == "c");
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "file_io.hpp"
+
+namespace {
+
+std::string temp_path(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+vector::Vector<std::uint64_t> sequence(size_t size) {
+  vector::Vector<std::uint64_t> values(size);
+  for (size_t i = 0; i < size; ++i) {
+    values[i] = i * 2654435761u;
+  }
+  return values;
+}
+
+} // namespace
+
+// 1 Запись и чтение несколькими параллельными запросами
+TEST(file_io, round_trip) {
+  const std::string path = temp_path("file_io_round_trip.bin");
+  const auto values = sequence(100000);
+  file_io::Options options;
+  options.request_size = 4096 * 3 + 8;
+  options.queue_depth = 4;
+  file_io::store_file(path, values, options);
+  ASSERT_TRUE(std::filesystem::file_size(path) == 100000 * 8);
+
+  const auto loaded = file_io::load_file<std::uint64_t>(path, options);
+  ASSERT_TRUE(loaded == values);
+  ASSERT_TRUE(loaded.capacity() == loaded.size());
+  std::filesystem::remove(path);
+}
+
+// 2 Чтение в существующий вектор заменяет его содержимое
+TEST(file_io, load_into_existing) {
+  const std::string path = temp_path("file_io_existing.bin");
+  file_io::store_file(path, sequence(10));
+  vector::Vector<std::uint64_t> values = sequence(1000);
+  file_io::load_file(path, values);
+  ASSERT_TRUE(values == sequence(10));
+
+  file_io::store_file(path, vector::Vector<std::uint64_t>());
+  file_io::load_file(path, values);
+  ASSERT_TRUE(values.empty());
+  std::filesystem::remove(path);
+}
+
+// 3 O_DIRECT с невыровненным по странице размером файла
+TEST(file_io, direct) {
+  const std::string path = temp_path("file_io_direct.bin");
+  vector::Vector<std::uint32_t, file_io::kDirectAlignment> values(5000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<std::uint32_t>(i);
+  }
+  file_io::Options options;
+  options.direct = true;
+  options.request_size = 8192;
+  file_io::store_file(path, values, options);
+  ASSERT_TRUE(std::filesystem::file_size(path) == 5000 * 4);
+
+  vector::Vector<std::uint32_t, file_io::kDirectAlignment> loaded;
+  file_io::load_file(path, loaded, options);
+  ASSERT_TRUE(loaded == values);
+  std::filesystem::remove(path);
+}
+
+// 4 Ошибки
+TEST(file_io, errors) {
+  ASSERT_THROW(file_io::load_file<int>(temp_path("file_io_missing.bin")),
+               std::system_error);
+
+  const std::string path = temp_path("file_io_odd.bin");
+  std::ofstream(path, std::ios::binary) << "abcde";
+  ASSERT_THROW(file_io::load_file<std::uint32_t>(path), std::runtime_error);
+
+  file_io::Options options;
+  options.direct = true;
+  ASSERT_THROW(file_io::load_file<char>(path, options), std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
+#if defined(FILE_IO_POSIX)
+// 5 Ошибка одного из параллельных запросов: остальные запросы дожидаются
+// завершения (в io_uring — до закрытия кольца), а out остаётся пустым.
+// Каталог открывается на чтение, но каждый read возвращает EISDIR
+TEST(file_io, failed_request) {
+  const std::string path = temp_path("file_io_failed_request");
+  std::filesystem::create_directory(path);
+  std::ofstream(path + "/entry") << "x";
+  struct stat info;
+  ASSERT_TRUE(::stat(path.c_str(), &info) == 0);
+  if (info.st_size == 0) {
+    std::filesystem::remove_all(path);
+    GTEST_SKIP() << "Directory size is zero on this file system";
+  }
+
+  file_io::Options options;
+  options.request_size = 1;
+  options.queue_depth = 4;
+  vector::Vector<char> out(10);
+  ASSERT_THROW(file_io::load_file(path, out, options), std::system_error);
+  ASSERT_TRUE(out.empty());
+  std::filesystem::remove_all(path);
+}
+#endif
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flat_map.hpp"
+
+// 1 Вставка и поиск по ключу
+TEST(flat_map, insert_find) {
+  flat_map::FlatMap<int, std::string> map;
+  ASSERT_TRUE(map.insert({2, "two"}).second);
+  ASSERT_TRUE(map.insert({1, "one"}).second);
+  ASSERT_FALSE(map.insert({2, "zwei"}).second);
+  ASSERT_TRUE(map.size() == 2);
+  ASSERT_TRUE(map.find(2).value() == "two");
+  ASSERT_TRUE(map.find(3) == map.end());
+  ASSERT_TRUE(map.contains(1));
+  ASSERT_THROW(map.at(5), std::out_of_range);
+}
+
+// 2 Построение из неотсортированного диапазона с повторами
+TEST(flat_map, bulk_construct) {
+  std::vector<std::pair<int, int>> pairs = {{5, 50}, {1, 10}, {3, 30},
+                                            {1, 11}, {5, 51}, {2, 20}};
+  flat_map::FlatMap<int, int> map(pairs.begin(), pairs.end());
+  ASSERT_TRUE(map.size() == 4);
+  int previous = 0;
+  for (auto [key, value] : map) {
+    ASSERT_TRUE(key > previous);
+    previous = key;
+  }
+  ASSERT_TRUE(map.at(1) == 10);
+  ASSERT_TRUE(map.at(5) == 50);
+}
+
+// 3 Пакетная вставка сливается с существующими ключами
+TEST(flat_map, batch_insert) {
+  flat_map::FlatMap<int, int> map = {{2, 2}, {4, 4}, {6, 6}};
+  std::vector<std::pair<int, int>> batch = {
+      {7, 7}, {1, 1}, {4, 40}, {3, 3}, {1, 10}};
+  map.insert(batch.begin(), batch.end());
+  ASSERT_TRUE(map.size() == 6);
+  int expected = 1;
+  for (auto [key, value] : map) {
+    if (expected == 5) {
+      ++expected;
+    }
+    ASSERT_TRUE(key == expected);
+    ASSERT_TRUE(value == expected);
+    ++expected;
+  }
+}
+
+// 4 Оператор [] и удаление
+TEST(flat_map, subscript_erase) {
+  flat_map::FlatMap<std::string, int> map;
+  map["b"] = 2;
+  map["a"] = 1;
+  ++map["b"];
+  ASSERT_TRUE(map.at("b") == 3);
+  ASSERT_TRUE(map.erase("a") == 1);
+  ASSERT_TRUE(map.erase("a") == 0);
+  ASSERT_TRUE(map.size() == 1);
+}
+
+// 5 Множество: вставка, пакетная вставка, поиск
+TEST(flat_set, insert_find) {
+  flat_map::FlatSet<int> set = {5, 3, 3, 9, 1};
+  ASSERT_TRUE(set.size() == 4);
+  ASSERT_FALSE(set.insert(3).second);
+  ASSERT_TRUE(set.insert(4).second);
+  std::vector<int> batch = {10, 0, 4, 10};
+  set.insert(batch.begin(), batch.end());
+  flat_map::FlatSet<int> expected = {0, 1, 3, 4, 5, 9, 10};
+  ASSERT_TRUE(set == expected);
+  ASSERT_TRUE(*set.lower_bound(6) == 9);
+  ASSERT_TRUE(set.find(2) == set.end());
+  ASSERT_TRUE(set.erase(9) == 1);
+  ASSERT_FALSE(set.contains(9));
+}
+
+// Значение, конструктор по умолчанию которого бросает по требованию
+struct ThrowingDefault {
+  static inline bool fail = false;
+  int value = 0;
+  ThrowingDefault() {
+    if (fail) {
+      throw std::runtime_error("default");
+    }
+  }
+  ThrowingDefault(int v) : value(v) {}
+};
+
+// 6 Исключение при пакетной вставке оставляет ключи и значения согласованными
+TEST(flat_map, batch_insert_exception) {
+  flat_map::FlatMap<int, ThrowingDefault> map;
+  map.try_emplace(2, 20);
+  std::vector<std::pair<int, ThrowingDefault>> batch = {{1, 10}, {3, 30}};
+  ThrowingDefault::fail = true;
+  ASSERT_THROW(map.insert(batch.begin(), batch.end()), std::runtime_error);
+  ThrowingDefault::fail = false;
+  ASSERT_TRUE(map.size() == 1);
+  ASSERT_TRUE(map.at(2).value == 20);
+  map.insert(batch.begin(), batch.end());
+  ASSERT_TRUE(map.size() == 3);
+  ASSERT_TRUE(map.at(1).value == 10 && map.at(3).value == 30);
+}
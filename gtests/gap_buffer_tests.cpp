@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "gap_buffer.hpp"
+
+namespace {
+std::string to_string(const gap_buffer::GapBuffer<char> &buffer) {
+  return std::string(buffer.begin(), buffer.end());
+}
+} // namespace
+
+// 1 Вставка элементов в конец
+TEST(gap_buffer, push_back) {
+  gap_buffer::GapBuffer<char> buffer;
+  for (char c : std::string("hello")) {
+    buffer.push_back(c);
+  }
+  ASSERT_TRUE(buffer.size() == 5);
+  ASSERT_TRUE(to_string(buffer) == "hello");
+}
+
+// 2 Вставка в середину и в начало
+TEST(gap_buffer, insert) {
+  gap_buffer::GapBuffer<char> buffer = {'a', 'c'};
+  buffer.insert(buffer.begin() + 1, 'b');
+  buffer.insert(buffer.begin(), '_');
+  ASSERT_TRUE(to_string(buffer) == "_abc");
+  std::string tail = "def";
+  buffer.insert(buffer.end(), tail.begin(), tail.end());
+  ASSERT_TRUE(to_string(buffer) == "_abcdef");
+}
+
+// 3 Удаление одного элемента и диапазона
+TEST(gap_buffer, erase) {
+  gap_buffer::GapBuffer<char> buffer = {'a', 'b', 'c', 'd', 'e', 'f'};
+  auto it = buffer.erase(buffer.begin() + 1);
+  ASSERT_TRUE(*it == 'c');
+  buffer.erase(buffer.begin() + 2, buffer.begin() + 4);
+  ASSERT_TRUE(to_string(buffer) == "acf");
+  buffer.pop_back();
+  ASSERT_TRUE(to_string(buffer) == "ac");
+  ASSERT_THROW(buffer.erase(buffer.begin() + 1, buffer.begin() + 5),
+               std::out_of_range);
+}
+
+// 4 Правки в разных местах с переносом разрыва
+TEST(gap_buffer, move_gap) {
+  gap_buffer::GapBuffer<std::string> buffer;
+  for (int i = 0; i < 100; ++i) {
+    buffer.push_back(std::to_string(i));
+  }
+  buffer.move_gap(10);
+  ASSERT_TRUE(buffer.cursor() == 10);
+  ASSERT_TRUE(buffer[10] == "10");
+  buffer.insert(buffer.begin() + 90, "x");
+  buffer.insert(buffer.begin() + 5, "y");
+  ASSERT_TRUE(buffer.size() == 102);
+  ASSERT_TRUE(buffer[5] == "y");
+  ASSERT_TRUE(buffer[6] == "5");
+  ASSERT_TRUE(buffer[91] == "x");
+  ASSERT_TRUE(buffer[101] == "99");
+}
+
+// 5 Вставка значения, лежащего в самом буфере
+TEST(gap_buffer, insert_self_reference) {
+  gap_buffer::GapBuffer<std::string> buffer = {"a", "b", "c"};
+  buffer.move_gap(3);
+  buffer.insert(buffer.begin(), buffer[2]);
+  ASSERT_TRUE(buffer[0] == "c");
+  ASSERT_TRUE(buffer[3] == "c");
+}
+
+// 6 Копирование и перемещение контейнера
+TEST(gap_buffer, copy_move) {
+  gap_buffer::GapBuffer<char> buffer = {'a', 'b', 'c', 'd'};
+  buffer.insert(buffer.begin() + 2, 'x');
+  gap_buffer::GapBuffer<char> copy = buffer;
+  ASSERT_TRUE(copy == buffer);
+  ASSERT_TRUE(to_string(copy) == "abxcd");
+  gap_buffer::GapBuffer<char> moved = std::move(copy);
+  ASSERT_TRUE(moved == buffer);
+  ASSERT_TRUE(copy.empty());
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "hash_map.hpp"
+
+// 1 Вставка и поиск
+TEST(hash_map, insert_find) {
+  hash_map::HashMap<int, std::string> map;
+  ASSERT_TRUE(map.insert({1, "one"}).second);
+  ASSERT_TRUE(map.insert({2, "two"}).second);
+  ASSERT_FALSE(map.insert({1, "uno"}).second);
+  ASSERT_TRUE(map.size() == 2);
+  ASSERT_TRUE(map.find(1).value() == "one");
+  ASSERT_TRUE(map.find(3) == map.end());
+  ASSERT_TRUE(map.contains(2));
+  ASSERT_THROW(map.at(3), std::out_of_range);
+}
+
+// 2 Рост таблицы и обход всех элементов
+TEST(hash_map, grow_and_iterate) {
+  hash_map::HashMap<int, int> map;
+  for (int i = 0; i < 10000; ++i) {
+    map[i] = i * 2;
+  }
+  ASSERT_TRUE(map.size() == 10000);
+  long long sum = 0;
+  size_t count = 0;
+  for (auto [key, value] : map) {
+    ASSERT_TRUE(value == key * 2);
+    sum += key;
+    ++count;
+  }
+  ASSERT_TRUE(count == 10000);
+  ASSERT_TRUE(sum == 10000LL * 9999 / 2);
+}
+
+// 3 Удаление обратным сдвигом сохраняет доступность остальных ключей
+TEST(hash_map, erase) {
+  hash_map::HashMap<int, int> map;
+  std::unordered_map<int, int> reference;
+  for (int i = 0; i < 5000; ++i) {
+    map[i * 7] = i;
+    reference[i * 7] = i;
+  }
+  for (int i = 0; i < 5000; i += 3) {
+    ASSERT_TRUE(map.erase(i * 7) == 1);
+    reference.erase(i * 7);
+  }
+  ASSERT_TRUE(map.erase(-1) == 0);
+  ASSERT_TRUE(map.size() == reference.size());
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(map.contains(i * 7) == (reference.count(i * 7) == 1));
+  }
+  map.erase(map.find(7));
+  ASSERT_FALSE(map.contains(7));
+}
+
+// 4 Резервирование без рехеширования
+TEST(hash_map, reserve) {
+  hash_map::HashMap<int, int> map;
+  map.reserve(1000);
+  const size_t capacity = map.capacity();
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  ASSERT_TRUE(map.capacity() == capacity);
+}
+
+// 5 Гетерогенный поиск по std::string_view
+TEST(hash_map, heterogeneous_lookup) {
+  hash_map::HashMap<std::string, int, hash_map::StringHash,
+                    hash_map::StringEqual>
+      map;
+  map["alpha"] = 1;
+  map["beta"] = 2;
+  std::string_view key = "beta";
+  ASSERT_TRUE(map.find(key).value() == 2);
+  ASSERT_TRUE(map.contains("alpha"));
+  ASSERT_TRUE(map.erase(std::string_view("alpha")) == 1);
+  ASSERT_FALSE(map.contains("alpha"));
+}
+
+// 6 Копирование, перемещение и очистка
+TEST(hash_map, copy_move_clear) {
+  hash_map::HashMap<std::string, std::string> map = {{"a", "1"}, {"b", "2"}};
+  auto copy = map;
+  ASSERT_TRUE(copy.size() == 2);
+  ASSERT_TRUE(copy.at("b") == "2");
+  auto moved = std::move(copy);
+  ASSERT_TRUE(moved.at("a") == "1");
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  ASSERT_FALSE(moved.contains("a"));
+}
+
+// 7 Множество
+TEST(hash_set, insert_find_erase) {
+  hash_map::HashSet<std::string, hash_map::StringHash, hash_map::StringEqual>
+      set = {"x", "y", "x"};
+  ASSERT_TRUE(set.size() == 2);
+  ASSERT_FALSE(set.insert("y").second);
+  ASSERT_TRUE(set.contains(std::string_view("x")));
+  ASSERT_TRUE(set.erase("x") == 1);
+  ASSERT_TRUE(set.size() == 1);
+  ASSERT_TRUE(*set.begin() == "y");
+}
+
+namespace {
+// Считает живые объекты; копирование бросает, когда исчерпан счётчик
+struct Tracked {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+
+  Tracked() { ++live; }
+  Tracked(const Tracked &) {
+    if (copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+    --copies_left;
+    ++live;
+  }
+  Tracked(Tracked &&) noexcept { ++live; }
+  ~Tracked() { --live; }
+};
+} // namespace
+
+// 8 Исключение при копировании таблицы освобождает скопированные слоты
+TEST(hash_map, copy_exception) {
+  Tracked::live = 0;
+  {
+    using TrackedMap = hash_map::HashMap<int, Tracked>;
+    TrackedMap map;
+    for (int i = 0; i < 10; ++i) {
+      map.try_emplace(i);
+    }
+    Tracked::copies_left = 4;
+    ASSERT_THROW(TrackedMap copy(map), std::runtime_error);
+    TrackedMap target;
+    target.try_emplace(42);
+    Tracked::copies_left = 4;
+    ASSERT_THROW(target = map, std::runtime_error);
+    Tracked::copies_left = -1;
+    ASSERT_TRUE(target.size() == 1 && target.contains(42));
+    ASSERT_TRUE(Tracked::live == 11);
+  }
+  ASSERT_TRUE(Tracked::live == 0);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "hybrid_list.hpp"
+
+// 1 Пока элементы помещаются в буфер, память не выделяется
+TEST(hybrid_list, inline_storage) {
+  hybrid_list::HybridList<int, 4> list1;
+  const size_t empty_usage = list1.memory_usage();
+  for (int i = 1; i <= 4; ++i) {
+    list1.push_back(i);
+  }
+  ASSERT_TRUE(!list1.is_linked());
+  ASSERT_TRUE(list1.memory_usage() == empty_usage);
+  ASSERT_TRUE(list1.size() == 4);
+  ASSERT_TRUE(list1[0] == 1 && list1[3] == 4);
+}
+
+// 2 Переполнение буфера переводит список в связный режим
+TEST(hybrid_list, grows_into_list) {
+  hybrid_list::HybridList<std::string, 2> list1 = {"b", "c"};
+  list1.push_front("a");
+  list1.push_back("d");
+  ASSERT_TRUE(list1.is_linked());
+  ASSERT_TRUE((list1 == hybrid_list::HybridList<std::string, 2>{"a", "b", "c",
+                                                               "d"}));
+  list1.clear();
+  ASSERT_TRUE(!list1.is_linked());
+  ASSERT_TRUE(list1.is_empty());
+}
+
+// 3 Вставка и удаление после позиции в обоих режимах
+TEST(hybrid_list, insert_erase) {
+  hybrid_list::HybridList<int, 3> list1 = {1, 3};
+  auto it = list1.insert(list1.cbegin(), 2);
+  ASSERT_TRUE(*it == 2);
+  it = list1.insert(it, 10);
+  ASSERT_TRUE(list1.is_linked());
+  ASSERT_TRUE(*it == 10);
+  ASSERT_TRUE(list1.erase(it) == list1.end());
+  list1.erase(list1.before_begin());
+  ASSERT_TRUE((list1 == hybrid_list::HybridList<int, 3>{2, 10}));
+  list1.pop_front();
+  ASSERT_TRUE(list1.size() == 1 && list1[0] == 10);
+}
+
+// 4 После stabilize() итераторы переживают вставки
+TEST(hybrid_list, stable_iterators) {
+  hybrid_list::HybridList<int> list1 = {1, 2, 3};
+  list1.stabilize();
+  auto second = ++list1.begin();
+  list1.push_front(0);
+  list1.insert(second, 5);
+  list1.push_back(4);
+  ASSERT_TRUE(*second == 2);
+  std::vector<int> values(list1.begin(), list1.end());
+  ASSERT_TRUE((values == std::vector<int>{0, 1, 2, 5, 3, 4}));
+}
+
+// 5 Копирование, перемещение и сравнение списков в разных режимах
+TEST(hybrid_list, copy_move) {
+  hybrid_list::HybridList<int, 2> small = {1, 2};
+  hybrid_list::HybridList<int, 2> large = {1, 2, 3};
+  hybrid_list::HybridList<int, 2> copy(large);
+  ASSERT_TRUE(copy == large && copy.is_linked());
+  ASSERT_TRUE(small < large);
+  copy = small;
+  ASSERT_TRUE(copy == small);
+  hybrid_list::HybridList<int, 2> moved(std::move(large));
+  ASSERT_TRUE(moved.size() == 3 && large.is_empty());
+  moved.swap(copy);
+  ASSERT_TRUE(copy.size() == 3 && moved.size() == 2);
+}
+
+// 6 Обход и проверка индекса
+TEST(hybrid_list, for_each_at) {
+  hybrid_list::HybridList<int, 2> list1 = {1, 2, 3};
+  list1.for_each([](int &value) { value *= 10; });
+  const int sum = list1.transform_reduce(
+      0, [](int lhs, int rhs) { return lhs + rhs; },
+      [](int value) { return value; });
+  ASSERT_TRUE(sum == 60);
+  ASSERT_TRUE(list1.at(2) == 30);
+  ASSERT_THROW(list1.at(3), std::out_of_range);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include "parallel.hpp"
+#include "vector.hpp"
+
+namespace {
+
+vector::Vector<int> random_values(size_t size) {
+  vector::Vector<int> values(size);
+  std::mt19937 random(42);
+  for (int &value : values) {
+    value = static_cast<int>(random() % 100000);
+  }
+  return values;
+}
+
+} // namespace
+
+// 1 Обход и преобразование
+TEST(parallel, for_each_transform) {
+  parallel::ThreadPool pool(4);
+  vector::Vector<int> values(100000);
+  parallel::for_each(pool, values.begin(), values.end(),
+                     [](int &value) { value = 2; }, 1000);
+  vector::Vector<long long> squares(values.size());
+  parallel::transform(pool, values.begin(), values.end(), squares.begin(),
+                      [](int value) { return 1ll * value * value; });
+  ASSERT_TRUE(std::all_of(squares.begin(), squares.end(),
+                          [](long long value) { return value == 4; }));
+}
+
+// 2 Свёртка совпадает с последовательной
+TEST(parallel, reduce) {
+  parallel::ThreadPool pool(4);
+  const auto values = random_values(123457);
+  const long long expected =
+      std::accumulate(values.begin(), values.end(), 0ll);
+  ASSERT_TRUE(parallel::reduce(pool, values.begin(), values.end(), 0ll) ==
+              expected);
+  ASSERT_TRUE(parallel::reduce(pool, values.begin(), values.end(), 0ll,
+                               std::plus<>(), 100) == expected);
+  ASSERT_TRUE(parallel::reduce(pool, values.begin(), values.begin(), 5) == 5);
+}
+
+// 3 Сортировка, в том числе с мелкими порциями
+TEST(parallel, sort) {
+  parallel::ThreadPool pool(4);
+  for (size_t grain : {0, 64, 1000}) {
+    auto values = random_values(200003);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel::sort(pool, values.begin(), values.end(), std::less<>(), grain);
+    ASSERT_TRUE(values == expected);
+  }
+  auto descending = random_values(50000);
+  parallel::sort(pool, descending.begin(), descending.end(), std::greater<>(),
+                 500);
+  ASSERT_TRUE(std::is_sorted(descending.begin(), descending.end(),
+                             std::greater<>()));
+}
+
+// 4 Префиксные суммы
+TEST(parallel, inclusive_scan) {
+  parallel::ThreadPool pool(3);
+  const auto values = random_values(10007);
+  vector::Vector<int> expected(values.size());
+  std::partial_sum(values.begin(), values.end(), expected.begin());
+  vector::Vector<int> result(values.size());
+  parallel::inclusive_scan(pool, values.begin(), values.end(), result.begin(),
+                           std::plus<>(), 100);
+  ASSERT_TRUE(result == expected);
+}
+
+// 5 Устойчивое разбиение
+TEST(parallel, partition) {
+  parallel::ThreadPool pool(4);
+  auto values = random_values(100000);
+  auto expected = values;
+  auto is_even = [](int value) { return value % 2 == 0; };
+  const auto expected_point =
+      std::stable_partition(expected.begin(), expected.end(), is_even);
+  const auto point = parallel::partition(pool, values.begin(), values.end(),
+                                         is_even, 999);
+  ASSERT_TRUE(point - values.begin() == expected_point - expected.begin());
+  ASSERT_TRUE(values == expected);
+}
+
+// 6 Исключение из задачи пробрасывается из wait, пул остаётся рабочим
+TEST(parallel, task_group_exception) {
+  parallel::ThreadPool pool(2);
+  std::atomic<int> done{0};
+  {
+    parallel::TaskGroup group(pool);
+    for (int i = 0; i < 10; ++i) {
+      group.run([&done, i] {
+        if (i == 3) {
+          throw std::runtime_error("task failed");
+        }
+        ++done;
+      });
+    }
+    ASSERT_THROW(group.wait(), std::runtime_error);
+  }
+  ASSERT_TRUE(done == 9);
+  vector::Vector<int> values(10000);
+  ASSERT_TRUE(parallel::reduce(pool, values.begin(), values.end(), 0) == 0);
+}
+
+// 7 Сортировка с порцией в один элемент завершается
+TEST(parallel, sort_unit_grain) {
+  parallel::ThreadPool pool(4);
+  for (size_t size : {2, 3, 4, 17, 1000}) {
+    auto values = random_values(size);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel::sort(pool, values.begin(), values.end(), std::less<>(), 1);
+    ASSERT_TRUE(values == expected);
+  }
+}
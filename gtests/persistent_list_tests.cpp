@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "persistent_list.hpp"
+
+// 1 Вставка в начало создаёт новую версию
+TEST(persistent_list, push_front) {
+  persistent_list::PersistentList<int> empty;
+  auto list1 = empty.push_front(1);
+  auto list2 = list1.push_front(2);
+  ASSERT_TRUE(empty.empty());
+  ASSERT_TRUE(list1.size() == 1);
+  ASSERT_TRUE(list1.front() == 1);
+  ASSERT_TRUE(list2.size() == 2);
+  ASSERT_TRUE(list2.front() == 2);
+}
+
+// 2 Версии разделяют общий хвост
+TEST(persistent_list, shared_tail) {
+  persistent_list::PersistentList<std::string> base = {"b", "c"};
+  auto left = base.push_front("a");
+  auto right = base.push_front("x");
+  ASSERT_TRUE(left.pop_front().shares_with(base));
+  ASSERT_TRUE(right.pop_front().shares_with(base));
+  ASSERT_TRUE(&*++left.begin() == &*++right.begin());
+}
+
+// 3 Удаление из начала не меняет исходную версию
+TEST(persistent_list, pop_front) {
+  persistent_list::PersistentList<int> list1 = {1, 2, 3};
+  auto list2 = list1.pop_front();
+  ASSERT_TRUE(list1.size() == 3);
+  ASSERT_TRUE(list2.size() == 2);
+  ASSERT_TRUE(list2.front() == 2);
+  ASSERT_TRUE(list2.pop_front().pop_front().pop_front().empty());
+  ASSERT_THROW(persistent_list::PersistentList<int>().front(),
+               std::out_of_range);
+}
+
+// 4 Сравнение списков
+TEST(persistent_list, is_equal) {
+  persistent_list::PersistentList<int> list1 = {1, 2, 3};
+  persistent_list::PersistentList<int> list2 =
+      persistent_list::PersistentList<int>{2, 3}.push_front(1);
+  ASSERT_TRUE(list1 == list2);
+  ASSERT_TRUE(list1 != list2.pop_front());
+}
+
+// 5 Длинная история версий освобождается без переполнения стека
+TEST(persistent_list, long_history) {
+  persistent_list::PersistentList<int> list;
+  for (int i = 0; i < 1000000; ++i) {
+    list = list.push_front(i);
+  }
+  ASSERT_TRUE(list.size() == 1000000);
+  ASSERT_TRUE(list.front() == 999999);
+}
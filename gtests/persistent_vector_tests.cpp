@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "persistent_vector.hpp"
+
+// 1 Вставка в конец создаёт новую версию
+TEST(persistent_vector, push_back) {
+  persistent_vector::PersistentVector<int> versions[2000 + 1];
+  for (int i = 0; i < 2000; ++i) {
+    versions[i + 1] = versions[i].push_back(i);
+  }
+  for (int v = 0; v <= 2000; v += 97) {
+    ASSERT_TRUE(versions[v].size() == static_cast<size_t>(v));
+    for (int i = 0; i < v; ++i) {
+      ASSERT_TRUE(versions[v][i] == i);
+    }
+  }
+}
+
+// 2 Запись в середину не меняет исходную версию
+TEST(persistent_vector, set) {
+  persistent_vector::PersistentVector<std::string> base;
+  for (int i = 0; i < 1500; ++i) {
+    base = base.push_back(std::to_string(i));
+  }
+  auto changed = base.set(5, "five").set(1400, "last");
+  ASSERT_TRUE(base[5] == "5");
+  ASSERT_TRUE(base[1400] == "1400");
+  ASSERT_TRUE(changed[5] == "five");
+  ASSERT_TRUE(changed[1400] == "last");
+  ASSERT_TRUE(&base[700] == &changed[700]);
+  ASSERT_THROW(base.set(1500, "x"), std::out_of_range);
+}
+
+// 3 Удаление из конца, в том числе с понижением высоты дерева
+TEST(persistent_vector, pop_back) {
+  persistent_vector::PersistentVector<int> full;
+  for (int i = 0; i < 1100; ++i) {
+    full = full.push_back(i);
+  }
+  auto vector1 = full;
+  while (!vector1.empty()) {
+    vector1 = vector1.pop_back();
+    if (!vector1.empty()) {
+      ASSERT_TRUE(vector1[vector1.size() - 1] ==
+                  static_cast<int>(vector1.size()) - 1);
+    }
+  }
+  ASSERT_TRUE(full.size() == 1100);
+  ASSERT_TRUE(full[1099] == 1099);
+  vector1 = vector1.push_back(7);
+  ASSERT_TRUE(vector1.size() == 1 && vector1[0] == 7);
+}
+
+// 4 Пакетные изменения через Transient
+TEST(persistent_vector, transient) {
+  persistent_vector::PersistentVector<int> base = {1, 2, 3};
+  auto batch = base.transient();
+  for (int i = 0; i < 5000; ++i) {
+    batch.push_back(i);
+  }
+  batch.set(0, 100);
+  batch.pop_back();
+  auto result = std::move(batch).persistent();
+  ASSERT_TRUE(result.size() == 5002);
+  ASSERT_TRUE(result[0] == 100);
+  ASSERT_TRUE(result[5001] == 4998);
+  ASSERT_TRUE(base.size() == 3);
+  ASSERT_TRUE(base[0] == 1);
+}
+
+// 5 Сравнение и итераторы
+TEST(persistent_vector, is_equal) {
+  persistent_vector::PersistentVector<int> vector1 = {1, 2, 3};
+  auto vector2 = persistent_vector::PersistentVector<int>{1, 2}.push_back(3);
+  ASSERT_TRUE(vector1 == vector2);
+  int sum = 0;
+  for (int value : vector1) {
+    sum += value;
+  }
+  ASSERT_TRUE(sum == 6);
+  ASSERT_TRUE(vector1 != vector2.set(0, 0));
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include "radix_sort.hpp"
+
+namespace {
+
+template <typename T> vector::Vector<T> random_values(size_t size) {
+  vector::Vector<T> values(size);
+  std::mt19937_64 random(7);
+  for (T &value : values) {
+    value = static_cast<T>(random());
+  }
+  return values;
+}
+
+} // namespace
+
+// 1 Беззнаковые ключи
+TEST(radix_sort, unsigned_keys) {
+  auto values = random_values<std::uint32_t>(100000);
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+  radix_sort::sort(values);
+  ASSERT_TRUE(values == expected);
+
+  auto wide = random_values<std::uint64_t>(5000);
+  auto wide_expected = wide;
+  std::sort(wide_expected.begin(), wide_expected.end());
+  radix_sort::sort(wide);
+  ASSERT_TRUE(wide == wide_expected);
+}
+
+// 2 Знаковые ключи и ключи с постоянными старшими разрядами
+TEST(radix_sort, signed_keys) {
+  vector::Vector<std::int64_t> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back((i * 7919) % 1000 - 500);
+  }
+  values.push_back(std::numeric_limits<std::int64_t>::min());
+  values.push_back(std::numeric_limits<std::int64_t>::max());
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+  radix_sort::sort(values);
+  ASSERT_TRUE(values == expected);
+}
+
+// 3 Числа с плавающей точкой
+TEST(radix_sort, float_keys) {
+  vector::Vector<float> values;
+  std::mt19937 random(3);
+  std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(distribution(random));
+  }
+  values.push_back(-std::numeric_limits<float>::infinity());
+  values.push_back(std::numeric_limits<float>::infinity());
+  values.push_back(0.0f);
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+  radix_sort::sort(values);
+  ASSERT_TRUE(values == expected);
+}
+
+// 4 Сортировка структур по ключу устойчива
+TEST(radix_sort, sort_by_key_is_stable) {
+  struct Record {
+    std::uint32_t key;
+    std::uint32_t order;
+  };
+  vector::Vector<Record> records;
+  for (std::uint32_t i = 0; i < 10000; ++i) {
+    records.push_back(Record{(i * 2654435761u) % 97, i});
+  }
+  radix_sort::sort_by_key(records, [](const Record &record) {
+    return record.key;
+  });
+  for (size_t i = 1; i < records.size(); ++i) {
+    ASSERT_TRUE(records[i - 1].key < records[i].key ||
+                (records[i - 1].key == records[i].key &&
+                 records[i - 1].order < records[i].order));
+  }
+}
+
+// 5 Параллельный вариант и граничные размеры
+TEST(radix_sort, parallel) {
+  parallel::ThreadPool pool(4);
+  auto values = random_values<std::uint32_t>(1 << 18);
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+  radix_sort::sort(pool, values);
+  ASSERT_TRUE(values == expected);
+
+  vector::Vector<std::uint32_t> empty;
+  radix_sort::sort(pool, empty);
+  ASSERT_TRUE(empty.empty());
+  vector::Vector<std::uint32_t> small;
+  small.push_back(3);
+  small.push_back(1);
+  small.push_back(2);
+  radix_sort::sort(small);
+  ASSERT_TRUE(small[0] == 1 && small[2] == 3);
+}
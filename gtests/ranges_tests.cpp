@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+#include "chunked_deque.hpp"
+#include "double_linked_list.hpp"
+#include "flat_map.hpp"
+#include "gap_buffer.hpp"
+#include "hash_map.hpp"
+#include "persistent_list.hpp"
+#include "persistent_vector.hpp"
+#include "shared_vector.hpp"
+#include "single_linked_list.hpp"
+#include "static_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+template <typename Range, typename Expected>
+bool equal(Range &&range, std::initializer_list<Expected> expected) {
+  return std::ranges::equal(range, expected);
+}
+
+using IntMap = flat_map::FlatMap<int, int>;
+using IntHashMap = hash_map::HashMap<int, int>;
+using IntStaticVector = static_vector::StaticVector<int, 8>;
+
+} // namespace
+
+// 1 Контейнеры удовлетворяют концептам диапазонов
+TEST(ranges, concepts) {
+  static_assert(std::ranges::contiguous_range<vector::Vector<int>>);
+  static_assert(std::ranges::contiguous_range<const vector::Vector<int>>);
+  static_assert(std::ranges::contiguous_range<IntStaticVector>);
+  static_assert(std::ranges::random_access_range<chunked_deque::ChunkedDeque<int>>);
+  static_assert(std::ranges::random_access_range<gap_buffer::GapBuffer<int>>);
+  static_assert(std::ranges::random_access_range<shared_vector::SharedVector<int>>);
+  static_assert(std::ranges::bidirectional_range<double_linked_list::DoubleLinkedList<int>>);
+  static_assert(std::ranges::forward_range<single_linked_list::SingleLinkedList<int>>);
+  static_assert(std::ranges::forward_range<persistent_list::PersistentList<int>>);
+  static_assert(std::ranges::forward_range<persistent_vector::PersistentVector<int>>);
+  static_assert(std::ranges::forward_range<IntMap>);
+  static_assert(std::ranges::forward_range<const IntMap>);
+  static_assert(std::ranges::forward_range<const IntHashMap>);
+
+  vector::Vector<int> values(3);
+  ASSERT_TRUE(std::ranges::data(values) == values.data());
+  ASSERT_TRUE(std::ranges::size(values) == 3);
+}
+
+// 2 Ленивая цепочка над Vector не меняет исходные данные
+TEST(ranges, vector_pipeline) {
+  vector::Vector<int> values;
+  for (int i = 0; i < 20; ++i) {
+    values.push_back(i);
+  }
+  auto pipeline = values | std::views::filter([](int x) { return x % 3 == 0; }) |
+                  std::views::transform([](int x) { return x * x; }) |
+                  std::views::take(4);
+  ASSERT_TRUE(equal(pipeline, {0, 9, 36, 81}));
+  ASSERT_TRUE(values.size() == 20 && values[3] == 3);
+
+  std::ranges::sort(values, std::ranges::greater{});
+  ASSERT_TRUE(values[0] == 19 && values[19] == 0);
+}
+
+// 3 Списки: обход по сторожу end() и обратный обход двусвязного списка
+TEST(ranges, lists) {
+  single_linked_list::SingleLinkedList<int> single{1, 2, 3, 4, 5};
+  ASSERT_TRUE(equal(single | std::views::drop(1) | std::views::take(3),
+                    {2, 3, 4}));
+  ASSERT_TRUE(std::ranges::find(single, 4) != single.end());
+
+  double_linked_list::DoubleLinkedList<int> double_list{1, 2, 3, 4};
+  ASSERT_TRUE(equal(double_list | std::views::reverse, {4, 3, 2, 1}));
+
+  const persistent_list::PersistentList<int> persistent{1, 2, 3};
+  ASSERT_TRUE(equal(persistent | std::views::transform([](int x) {
+                      return x + 1;
+                    }),
+                    {2, 3, 4}));
+}
+
+// 4 Контейнеры с произвольным доступом
+TEST(ranges, random_access) {
+  chunked_deque::ChunkedDeque<int> deque{5, 3, 1, 4, 2};
+  std::ranges::sort(deque);
+  ASSERT_TRUE(equal(deque, {1, 2, 3, 4, 5}));
+
+  gap_buffer::GapBuffer<int> buffer{1, 2, 3};
+  ASSERT_TRUE(equal(buffer | std::views::reverse, {3, 2, 1}));
+
+  shared_vector::SharedVector<int> shared{1, 2, 3, 4};
+  ASSERT_TRUE(equal(shared | std::views::reverse | std::views::take(2),
+                    {4, 3}));
+  ASSERT_TRUE(std::ranges::lower_bound(shared, 3) - shared.begin() == 2);
+}
+
+// 5 Ассоциативные контейнеры отдают пары ссылок
+TEST(ranges, maps) {
+  IntMap map{{3, 30}, {1, 10}, {2, 20}};
+  auto values = map | std::views::transform([](const auto &item) {
+                  return item.second;
+                });
+  ASSERT_TRUE(equal(values, {10, 20, 30}));
+
+  const IntHashMap hash{{1, 10}, {2, 20}};
+  auto big = hash | std::views::filter([](const auto &item) {
+               return item.second > 15;
+             });
+  ASSERT_TRUE(std::ranges::distance(big) == 1);
+  ASSERT_TRUE((*big.begin()).first == 2);
+}
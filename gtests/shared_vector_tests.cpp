@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include "shared_vector.hpp"
+
+// 1 Вставка элементов в конец и чтение
+TEST(shared_vector, push_back) {
+  shared_vector::SharedVector<int, 16> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(i);
+  }
+  ASSERT_TRUE(values.size() == 100);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(values[i] == i);
+  }
+  ASSERT_THROW(values.at(100), std::out_of_range);
+}
+
+// 2 Снимок не видит последующих изменений
+TEST(shared_vector, snapshot_is_isolated) {
+  shared_vector::SharedVector<int, 16> values = {1, 2, 3};
+  auto snapshot = values.snapshot();
+  ASSERT_TRUE(values.use_count() == 2);
+  values.push_back(4);
+  values.set(0, 10);
+  ASSERT_TRUE(snapshot.size() == 3);
+  ASSERT_TRUE(snapshot[0] == 1);
+  ASSERT_TRUE(values.size() == 4);
+  ASSERT_TRUE(values[0] == 10);
+  ASSERT_TRUE(values.use_count() == 1);
+}
+
+// 3 Изменение копирует только затронутый блок
+TEST(shared_vector, copy_touched_chunk_only) {
+  shared_vector::SharedVector<int, 16> values;
+  for (int i = 0; i < 64; ++i) {
+    values.push_back(i);
+  }
+  auto snapshot = values.snapshot();
+  values.mutable_ref(40) = -1;
+  ASSERT_TRUE(&values[0] == &snapshot[0]);
+  ASSERT_TRUE(&values[63] == &snapshot[63]);
+  ASSERT_TRUE(&values[40] != &snapshot[40]);
+  ASSERT_TRUE(snapshot[40] == 40);
+  ASSERT_TRUE(values[40] == -1);
+}
+
+// 4 Удаление элементов из конца
+TEST(shared_vector, pop_back) {
+  shared_vector::SharedVector<std::string, 16> values;
+  for (int i = 0; i < 40; ++i) {
+    values.push_back(std::to_string(i));
+  }
+  auto snapshot = values.snapshot();
+  while (values.size() > 5) {
+    values.pop_back();
+  }
+  values.push_back("new");
+  ASSERT_TRUE(values.size() == 6);
+  ASSERT_TRUE(values[5] == "new");
+  ASSERT_TRUE(snapshot.size() == 40);
+  ASSERT_TRUE(snapshot[5] == "5");
+  values.clear();
+  ASSERT_TRUE(values.empty());
+}
+
+// 5 Сравнение и итераторы
+TEST(shared_vector, is_equal) {
+  shared_vector::SharedVector<int> values1 = {1, 2, 3};
+  shared_vector::SharedVector<int> values2 = {1, 2, 3};
+  ASSERT_TRUE(values1 == values2);
+  int sum = 0;
+  for (int value : values1) {
+    sum += value;
+  }
+  ASSERT_TRUE(sum == 6);
+  values2.set(2, 4);
+  ASSERT_FALSE(values1 == values2);
+}
+
+// 6 Читатели работают со снимками, пока писатель дописывает элементы
+TEST(shared_vector, concurrent_readers) {
+  shared_vector::SharedVector<int, 16> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(i);
+  }
+  vector::Vector<std::thread> readers;
+  for (int r = 0; r < 4; ++r) {
+    readers.emplace_back([snapshot = values.snapshot()] {
+      long long sum = 0;
+      for (int value : snapshot) {
+        sum += value;
+      }
+      EXPECT_EQ(sum, 999 * 1000 / 2);
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(i);
+    values.set(i, -i);
+  }
+  for (std::thread &reader : readers) {
+    reader.join();
+  }
+  ASSERT_TRUE(values.size() == 2000);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <utility>
+#include <vector>
+
 #include "single_linked_list.hpp"
 
 // 1 Создание контейнера
@@ -152,3 +155,62 @@ TEST(single_linked_list, clear) {
   single_linked_list2.clear();
   ASSERT_TRUE(single_linked_list1 == single_linked_list2);
 }
+
+TEST(single_linked_list, memory_usage) {
+  single_linked_list::SingleLinkedList<int> single_linked_list1;
+  const size_t empty_usage = single_linked_list1.memory_usage();
+  single_linked_list1.push_back(1);
+  single_linked_list1.push_back(2);
+  ASSERT_TRUE(single_linked_list1.memory_usage() >
+              empty_usage + 2 * sizeof(int));
+  single_linked_list1.clear();
+  ASSERT_TRUE(single_linked_list1.memory_usage() == empty_usage);
+}
+
+TEST(single_linked_list, for_each) {
+  single_linked_list::SingleLinkedList<int> single_linked_list1 = {1, 2, 3};
+  single_linked_list1.for_each([](int &value) { value *= 10; });
+  ASSERT_TRUE(single_linked_list1[2] == 30);
+  const int sum = single_linked_list1.transform_reduce(
+      0, [](int lhs, int rhs) { return lhs + rhs; },
+      [](int value) { return value / 10; });
+  ASSERT_TRUE(sum == 6);
+}
+
+TEST(single_linked_list, for_each_interleaved) {
+  single_linked_list::SingleLinkedList<int> single_linked_list1 = {1, 2, 3};
+  single_linked_list::SingleLinkedList<int> single_linked_list2 = {10};
+  single_linked_list::SingleLinkedList<int> single_linked_list3;
+  std::vector<std::pair<size_t, int>> visited;
+  single_linked_list::SingleLinkedList<int>::for_each_interleaved(
+      [&](size_t list, int value) { visited.emplace_back(list, value); },
+      single_linked_list1, single_linked_list2, single_linked_list3);
+  const std::vector<std::pair<size_t, int>> expected = {
+      {0, 1}, {1, 10}, {0, 2}, {0, 3}};
+  ASSERT_TRUE(visited == expected);
+}
+
+TEST(single_linked_list, checked_access) {
+  single_linked_list::SingleLinkedList<int> single_linked_list1 = {1, 2, 3};
+  ASSERT_TRUE(single_linked_list1[1] == 2);
+  ASSERT_TRUE(single_linked_list1.at(2) == 3);
+  ASSERT_THROW(single_linked_list1.at(3), std::out_of_range);
+}
+
+TEST(single_linked_list, block_nodes) {
+  single_linked_list::SingleLinkedList<int> empty;
+  ASSERT_TRUE(empty.memory_usage() == sizeof(empty));
+
+  single_linked_list::SingleLinkedList<int> source = {1, 2, 3, 4};
+  single_linked_list::SingleLinkedList<int> copy(source);
+  ASSERT_TRUE(copy == source);
+  const size_t usage = copy.memory_usage();
+  copy.pop_front();
+  copy.erase(copy.cbegin());
+  ASSERT_TRUE(copy.memory_usage() == usage);
+  copy.push_back(5);
+  ASSERT_TRUE((copy == single_linked_list::SingleLinkedList<int>{2, 4, 5}));
+  copy.clear();
+  ASSERT_TRUE(copy.memory_usage() == sizeof(copy));
+  ASSERT_TRUE(source.size() == 4);
+}
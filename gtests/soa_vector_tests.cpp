@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "soa_vector.hpp"
+
+// 1 Вставка строк в конец
+TEST(soa_vector, push_back) {
+  soa_vector::SoaVector<int, double> soa;
+  for (int i = 1; i <= 3; ++i) {
+    soa.push_back(i, i * 0.5);
+  }
+  ASSERT_TRUE(soa.size() == 3);
+  ASSERT_TRUE(soa[0].get<0>() == 1);
+  ASSERT_TRUE(soa[2].get<0>() == 3);
+  ASSERT_TRUE(soa[2].get<1>() == 1.5);
+}
+
+// 2 Конструирование строки на месте
+TEST(soa_vector, emplace_back) {
+  soa_vector::SoaVector<std::string, int> soa;
+  auto row = soa.emplace_back("aaa", 0);
+  ASSERT_TRUE(row.get<0>() == "aaa");
+  row.get<1>() = 7;
+  ASSERT_TRUE(soa[0].value() == std::make_tuple(std::string("aaa"), 7));
+}
+
+// 3 Колонки лежат в памяти непрерывно
+TEST(soa_vector, column) {
+  soa_vector::SoaVector<int, double> soa;
+  for (int i = 1; i <= 100; ++i) {
+    soa.push_back(i, 0.0);
+  }
+  auto ids = soa.column<0>();
+  ASSERT_TRUE(ids.size() == 100);
+  ASSERT_TRUE(&ids[99] == ids.data() + 99);
+  ASSERT_TRUE(std::accumulate(ids.begin(), ids.end(), 0) == 5050);
+}
+
+// 4 Удаление строк из середины и из конца
+TEST(soa_vector, erase) {
+  soa_vector::SoaVector<int, std::string> soa;
+  soa.push_back(1, "one");
+  soa.push_back(2, "two");
+  soa.push_back(3, "three");
+  soa.erase(1);
+  ASSERT_TRUE(soa.size() == 2);
+  ASSERT_TRUE(soa[1].get<0>() == 3);
+  ASSERT_TRUE(soa[1].get<1>() == "three");
+  soa.pop_back();
+  ASSERT_TRUE(soa.size() == 1);
+  ASSERT_THROW(soa.erase(1), std::out_of_range);
+}
+
+// 5 Присваивание строки через прокси
+TEST(soa_vector, row_assign) {
+  soa_vector::SoaVector<int, char> soa;
+  soa.push_back(1, 'a');
+  soa[0] = std::make_tuple(5, 'z');
+  ASSERT_TRUE(soa[0].get<0>() == 5);
+  ASSERT_TRUE(soa[0].get<1>() == 'z');
+}
+
+// 6 Копирование и перемещение контейнера
+TEST(soa_vector, copy_move) {
+  soa_vector::SoaVector<int, std::string> soa;
+  soa.reserve(10);
+  ASSERT_TRUE(soa.capacity() == 10);
+  soa.push_back(1, "one");
+  soa.push_back(2, "two");
+
+  soa_vector::SoaVector<int, std::string> copy = soa;
+  ASSERT_TRUE(copy.size() == 2);
+  ASSERT_TRUE(copy[1].get<1>() == "two");
+
+  soa_vector::SoaVector<int, std::string> moved = std::move(copy);
+  ASSERT_TRUE(moved.size() == 2);
+  ASSERT_TRUE(copy.size() == 0);
+  ASSERT_TRUE(moved[0].get<1>() == "one");
+}
+
+namespace {
+// Копирование бросает после countdown копий, перемещение не noexcept
+struct ThrowingCopy {
+  static inline int countdown = -1;
+  int value;
+  ThrowingCopy(int v) : value(v) {}
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+  ThrowingCopy(ThrowingCopy &&other) : ThrowingCopy(other) {}
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+};
+} // namespace
+
+// 7 Исключение при росте не портит строки с перемещаемыми колонками
+TEST(soa_vector, growth_keeps_rows_on_exception) {
+  soa_vector::SoaVector<std::string, ThrowingCopy> soa;
+  soa.reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    soa.push_back(std::string(32, static_cast<char>('a' + i)), i);
+  }
+  ThrowingCopy::countdown = 3;
+  ASSERT_THROW(soa.push_back("e", 4), std::runtime_error);
+  ThrowingCopy::countdown = -1;
+  ASSERT_TRUE(soa.size() == 4 && soa.capacity() == 4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(soa[i].get<0>() == std::string(32, static_cast<char>('a' + i)));
+    ASSERT_TRUE(soa[i].get<1>().value == i);
+  }
+}
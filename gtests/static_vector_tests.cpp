@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "static_vector.hpp"
+
+namespace {
+constexpr static_vector::StaticVector<int, 10> make_squares() {
+  static_vector::StaticVector<int, 10> squares;
+  for (int i = 0; i < 10; ++i) {
+    squares.push_back(i * i);
+  }
+  squares.erase(squares.begin());
+  squares.insert(squares.begin(), -1);
+  return squares;
+}
+
+// Таблица строится на этапе компиляции
+constexpr auto kSquares = make_squares();
+static_assert(kSquares.size() == 10);
+static_assert(kSquares[0] == -1);
+static_assert(kSquares[9] == 81);
+} // namespace
+
+// 1 Вставка элементов в конец
+TEST(static_vector, push_back) {
+  static_vector::StaticVector<int, 4> vector1;
+  for (int i = 1; i <= 3; ++i) {
+    ASSERT_TRUE(vector1.push_back(i));
+  }
+  ASSERT_TRUE(vector1.size() == 3);
+  ASSERT_TRUE(vector1[2] == 3);
+  ASSERT_TRUE(vector1.capacity() == 4);
+}
+
+// 2 Вставка и удаление в середине
+TEST(static_vector, insert_erase) {
+  static_vector::StaticVector<std::string, 8> vector1 = {"a", "c"};
+  vector1.insert(vector1.begin() + 1, "b");
+  vector1.insert(vector1.begin(), "_");
+  ASSERT_TRUE(vector1.size() == 4);
+  ASSERT_TRUE(vector1[0] == "_");
+  ASSERT_TRUE(vector1[2] == "b");
+  vector1.erase(vector1.begin());
+  ASSERT_TRUE(vector1[0] == "a");
+  vector1.pop_back();
+  ASSERT_TRUE(vector1.size() == 2);
+  ASSERT_TRUE(vector1.back() == "b");
+}
+
+// 3 Политики переполнения
+TEST(static_vector, overflow_policies) {
+  static_vector::StaticVector<int, 2> throwing = {1, 2};
+  ASSERT_THROW(throwing.push_back(3), std::length_error);
+
+  static_vector::StaticVector<int, 2, static_vector::CheckedOverflow> checked =
+      {1, 2};
+  ASSERT_FALSE(checked.push_back(3));
+  ASSERT_TRUE(checked.emplace_back(3) == nullptr);
+  ASSERT_TRUE(checked.insert(checked.begin(), 0) == checked.end());
+  ASSERT_FALSE(checked.resize(3));
+  ASSERT_TRUE(checked.size() == 2);
+
+  static_vector::StaticVector<int, 2, static_vector::AbortOnOverflow> aborting;
+  aborting.push_back(1);
+  ASSERT_DEATH(
+      {
+        aborting.push_back(2);
+        aborting.push_back(3);
+      },
+      "");
+}
+
+// 4 Копирование и перемещение нетривиальных элементов
+TEST(static_vector, copy_move) {
+  static_vector::StaticVector<std::string, 4> vector1 = {"one", "two"};
+  static_vector::StaticVector<std::string, 4> vector2 = vector1;
+  ASSERT_TRUE(vector1 == vector2);
+  static_vector::StaticVector<std::string, 4> vector3 = {"x", "y", "z"};
+  vector3 = vector1;
+  ASSERT_TRUE(vector3 == vector1);
+  static_vector::StaticVector<std::string, 4> vector4 = std::move(vector2);
+  ASSERT_TRUE(vector4 == vector1);
+}
+
+// 5 Удаление контейнера вызывает деструкторы элементов
+TEST(static_vector, call_destructors) {
+  static int counter = 0;
+  struct Helper {
+    ~Helper() { ++counter; }
+  };
+  {
+    static_vector::StaticVector<Helper, 4> vector1;
+    vector1.emplace_back();
+    vector1.emplace_back();
+    vector1.resize(3);
+    counter = 0;
+  }
+  ASSERT_TRUE(counter == 3);
+}
+
+// 6 Конструирование тривиальных элементов допускает преобразования
+TEST(static_vector, emplace_converts) {
+  const long long big = 7;
+  static_vector::StaticVector<int, 4> vector1;
+  vector1.emplace_back(big);
+  vector1.emplace_back('a');
+  vector1.emplace_back();
+  ASSERT_TRUE(vector1[0] == 7);
+  ASSERT_TRUE(vector1[1] == 'a');
+  ASSERT_TRUE(vector1[2] == 0);
+}
+
+namespace {
+// Считает живые объекты; конструктор по умолчанию и перемещающее
+// присваивание бросают, когда исчерпан соответствующий счётчик
+struct Tracked {
+  static inline int live = 0;
+  static inline int constructions_left = -1;
+  static inline int assignments_left = -1;
+
+  Tracked() {
+    if (constructions_left == 0) {
+      throw std::runtime_error("construct");
+    }
+    --constructions_left;
+    ++live;
+  }
+  Tracked(const Tracked &) { ++live; }
+  Tracked(Tracked &&) noexcept { ++live; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) {
+    if (assignments_left == 0) {
+      throw std::runtime_error("assign");
+    }
+    --assignments_left;
+    return *this;
+  }
+  ~Tracked() { --live; }
+};
+} // namespace
+
+// 7 Исключение в конструкторе при resize не портит контейнер
+TEST(static_vector, resize_exception) {
+  Tracked::live = 0;
+  {
+    static_vector::StaticVector<Tracked, 8> vector1;
+    Tracked::constructions_left = 2;
+    ASSERT_THROW(vector1.resize(5), std::runtime_error);
+    Tracked::constructions_left = -1;
+    ASSERT_TRUE(vector1.size() == 2);
+    ASSERT_TRUE(Tracked::live == 2);
+  }
+  ASSERT_TRUE(Tracked::live == 0);
+}
+
+// 8 Исключение при сдвиге в emplace не теряет перенесённый элемент
+TEST(static_vector, emplace_exception) {
+  Tracked::live = 0;
+  {
+    static_vector::StaticVector<Tracked, 8> vector1;
+    vector1.resize(3);
+    Tracked::assignments_left = 1;
+    ASSERT_THROW(vector1.emplace(vector1.begin()), std::runtime_error);
+    Tracked::assignments_left = -1;
+    ASSERT_TRUE(vector1.size() == 4);
+    ASSERT_TRUE(Tracked::live == 4);
+  }
+  ASSERT_TRUE(Tracked::live == 0);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "double_linked_list.hpp"
+#include "single_linked_list.hpp"
+#include "telemetry.hpp"
+#include "vector.hpp"
+
+// Собирается отдельной программой containers_telemetry_tests с
+// CONTAINERS_TELEMETRY=1
+static_assert(telemetry::kEnabled, "Build with CONTAINERS_TELEMETRY=1");
+
+namespace {
+// Устанавливает Recorder на время теста
+struct Recording {
+  telemetry::Recorder recorder;
+  Recording() { telemetry::set_hook(&recorder); }
+  ~Recording() { telemetry::set_hook(nullptr); }
+};
+} // namespace
+
+// 1 Гистограммы операций вектора и списков
+TEST(telemetry, operation_histograms) {
+  Recording recording;
+  vector::Vector<int> vector1;
+  for (int i = 0; i < 10; ++i) {
+    vector1.push_back(i);
+  }
+  vector1.insert(vector1.begin(), 5);
+  vector1.erase(vector1.begin());
+  vector1.clear();
+  single_linked_list::SingleLinkedList<int> list1;
+  list1.push_front(1);
+  list1.pop_front();
+  double_linked_list::DoubleLinkedList<int> list2;
+  list2.push_back(1);
+  list2.insert(list2.cbefore_begin(), 2);
+
+  using telemetry::Container;
+  using telemetry::Operation;
+  const auto &recorder = recording.recorder;
+  ASSERT_TRUE(recorder.histogram(Container::Vector, Operation::Push).count() ==
+              10);
+  // 1, 2, 4, 8 и 16 элементов
+  ASSERT_TRUE(recorder.histogram(Container::Vector, Operation::Grow).count() ==
+              5);
+  ASSERT_TRUE(
+      recorder.histogram(Container::Vector, Operation::Insert).count() == 1);
+  ASSERT_TRUE(recorder.histogram(Container::Vector, Operation::Erase).count() ==
+              1);
+  ASSERT_TRUE(recorder.histogram(Container::Vector, Operation::Clear).count() ==
+              1);
+  ASSERT_TRUE(recorder.histogram(Container::SingleLinkedList, Operation::Erase)
+                  .count() == 1);
+  ASSERT_TRUE(recorder.histogram(Container::DoubleLinkedList, Operation::Insert)
+                  .count() == 1);
+}
+
+// 2 Перераспределения с метками мест вызова
+TEST(telemetry, tagged_reallocations) {
+  Recording recording;
+  vector::Vector<int> vector1;
+  {
+    telemetry::ScopedTag tag("parser");
+    vector1.reserve(100);
+    vector1.resize(300);
+  }
+  vector1.push_back(1);
+  const auto totals = recording.recorder.reallocations(
+      telemetry::Container::Vector, "parser");
+  ASSERT_TRUE(totals.count == 2);
+  ASSERT_TRUE(totals.max_capacity == 300);
+  ASSERT_TRUE(totals.bytes == (100 + 300) * sizeof(int));
+  ASSERT_TRUE(recording.recorder
+                  .reallocations(telemetry::Container::Vector, "untagged")
+                  .count == 1);
+  const std::string json = recording.recorder.json();
+  ASSERT_TRUE(json.find("\"tag\":\"parser\",\"element_size\":4,"
+                        "\"size_before\":0,\"size_after\":0,"
+                        "\"capacity_before\":100,\"capacity_after\":300") !=
+              std::string::npos);
+  ASSERT_TRUE(json.find("\"size_before\":300,\"size_after\":301,"
+                        "\"capacity_before\":300,\"capacity_after\":600") !=
+              std::string::npos);
+}
+
+// 3 Текстовый формат Prometheus
+TEST(telemetry, prometheus_export) {
+  Recording recording;
+  vector::Vector<int> vector1;
+  {
+    CONTAINERS_TELEMETRY_HERE;
+    vector1.push_back(1);
+  }
+  const std::string text = recording.recorder.prometheus();
+  ASSERT_TRUE(text.find("# TYPE containers_operation_duration_seconds "
+                        "histogram") != std::string::npos);
+  ASSERT_TRUE(text.find("containers_operation_duration_seconds_bucket{"
+                        "container=\"vector\",operation=\"push\",le=\"+Inf\"} "
+                        "1\n") != std::string::npos);
+  ASSERT_TRUE(text.find("containers_operation_duration_seconds_count{"
+                        "container=\"vector\",operation=\"push\"} 1\n") !=
+              std::string::npos);
+  ASSERT_TRUE(text.find("containers_reallocations_total{container=\"vector\","
+                        "tag=\"") != std::string::npos);
+  ASSERT_TRUE(text.find("telemetry_tests.cpp:") != std::string::npos);
+}
+
+// 4 Без обработчика ничего не записывается
+TEST(telemetry, no_hook) {
+  telemetry::Recorder recorder;
+  vector::Vector<int> vector1;
+  vector1.push_back(1);
+  ASSERT_TRUE(telemetry::hook() == nullptr);
+  ASSERT_TRUE(recorder.histogram(telemetry::Container::Vector,
+                                 telemetry::Operation::Push)
+                  .count() == 0);
+  ASSERT_TRUE(recorder.json().find("\"operations\":[]") != std::string::npos);
+}
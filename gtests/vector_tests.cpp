@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <set>
+#include <string>
+
 #include "vector.hpp"
 
 // 1 Создание контейнера
@@ -144,3 +147,298 @@ TEST(vector, is_equal_empty) {
   ASSERT_TRUE(vector1 == vector2);
 }
 
+
+TEST(vector, reserve_resize) {
+  vector::Vector<int> vector1;
+  vector1.reserve(10);
+  ASSERT_TRUE(vector1.capacity() == 10);
+  ASSERT_TRUE(vector1.empty());
+  vector1.resize(5);
+  ASSERT_TRUE(vector1.size() == 5);
+  ASSERT_TRUE(vector1[4] == 0);
+  vector1.resize(2);
+  ASSERT_TRUE(vector1.size() == 2);
+}
+
+TEST(vector, clear) {
+  vector::Vector<int> vector1;
+  for (int i = 1; i <= 3; ++i) {
+    vector1.push_back(i);
+  }
+  vector1.clear();
+  ASSERT_TRUE(vector1.empty());
+  ASSERT_TRUE(vector1.capacity() >= 3);
+}
+
+TEST(vector, cache_line_alignment) {
+  vector::Vector<char, vector::kCacheLineAlignment> vector1;
+  for (int i = 0; i < 100; ++i) {
+    vector1.push_back('a');
+  }
+  const auto address = reinterpret_cast<std::uintptr_t>(vector1.data());
+  ASSERT_TRUE(address % vector::kCacheLineAlignment == 0);
+  ASSERT_TRUE(vector1.size() == 100);
+}
+
+TEST(vector, huge_page_backed) {
+  const size_t old_threshold = vector::huge_page_threshold();
+  vector::set_huge_page_threshold(4096);
+  {
+    vector::RawMemory<int> small(16);
+    ASSERT_FALSE(small.is_huge_page_backed());
+    vector::RawMemory<int> big(4096);
+    ASSERT_TRUE(big.is_huge_page_backed());
+    const auto address = reinterpret_cast<std::uintptr_t>(big.get_address());
+    ASSERT_TRUE(address % vector::kHugePageSize == 0);
+
+    vector::Vector<int> vector1;
+    vector1.resize(10000);
+    vector1[9999] = 7;
+    vector::Vector<int> vector2(std::move(vector1));
+    ASSERT_TRUE(vector2[9999] == 7);
+    small = std::move(big);
+    ASSERT_TRUE(small.is_huge_page_backed());
+  }
+  vector::set_huge_page_threshold(old_threshold);
+}
+
+TEST(vector, numa_first_touch) {
+  vector::NumaPolicy policy;
+  policy.placement = vector::NumaPlacement::FirstTouch;
+  policy.threads = 4;
+  vector::Vector<int> vector1(100000, policy);
+  ASSERT_TRUE(vector1.size() == 100000);
+  ASSERT_TRUE(std::all_of(vector1.begin(), vector1.end(),
+                          [](int value) { return value == 0; }));
+  const int node = vector::numa_node_of(vector1.data());
+  ASSERT_TRUE(node == -1 || node < static_cast<int>(vector::numa_node_count()));
+}
+
+TEST(vector, numa_interleave) {
+  vector::NumaPolicy policy;
+  policy.placement = vector::NumaPlacement::Interleave;
+  vector::Vector<int> vector1(1000, policy);
+  vector1[999] = 5;
+  vector1.push_back(6);
+  ASSERT_TRUE(vector1.size() == 1001);
+  ASSERT_TRUE(vector1[999] == 5);
+  ASSERT_TRUE(vector1[1000] == 6);
+  // Политика переживает рост, сжатие и копирование
+  vector1.reserve(5000);
+  vector1.shrink_to_fit();
+  vector::Vector<int> copy(vector1);
+  vector::Vector<int> assigned;
+  assigned = vector1;
+  ASSERT_TRUE(vector1.numa_policy().placement ==
+              vector::NumaPlacement::Interleave);
+  ASSERT_TRUE(copy.numa_policy().placement ==
+              vector::NumaPlacement::Interleave);
+  ASSERT_TRUE(assigned.numa_policy().placement ==
+              vector::NumaPlacement::Local);
+  ASSERT_TRUE(copy[1000] == 6 && assigned[999] == 5);
+  ASSERT_TRUE(vector::numa_partition_begin(10, 3, 0) == 0);
+  ASSERT_TRUE(vector::numa_partition_begin(10, 3, 1) == 4);
+  ASSERT_TRUE(vector::numa_partition_begin(10, 3, 3) == 10);
+}
+
+TEST(vector, shrink_to_fit) {
+  vector::Vector<int> vector1;
+  vector1.reserve(100);
+  vector1.push_back(1);
+  vector1.push_back(2);
+  vector1.shrink_to_fit();
+  ASSERT_TRUE(vector1.capacity() == 2);
+  ASSERT_TRUE(vector1[0] == 1 && vector1[1] == 2);
+  ASSERT_TRUE(vector1.memory_usage() == sizeof(vector1) + 2 * sizeof(int));
+  vector1.clear_and_release();
+  ASSERT_TRUE(vector1.empty());
+  ASSERT_TRUE(vector1.capacity() == 0);
+}
+
+TEST(vector, auto_shrink) {
+  vector::Vector<int> vector1;
+  vector1.set_shrink_ratio(4);
+  vector1.resize(100);
+  while (vector1.size() > 10) {
+    vector1.pop_back();
+  }
+  ASSERT_TRUE(vector1.capacity() < 100);
+  ASSERT_TRUE(vector1.capacity() >= vector1.size());
+  vector1.erase(vector1.begin());
+  ASSERT_TRUE(vector1.size() == 9);
+  vector1.resize(1);
+  ASSERT_TRUE(vector1.capacity() == 2);
+}
+
+TEST(vector, auto_shrink_never_grows) {
+  for (size_t ratio = 1; ratio <= 5; ++ratio) {
+    vector::Vector<int> vector1;
+    vector1.set_shrink_ratio(ratio);
+    vector1.resize(1000);
+    size_t capacity = vector1.capacity();
+    size_t reallocations = 0;
+    while (!vector1.empty()) {
+      if (vector1.size() % 2) {
+        vector1.erase(vector1.begin());
+      } else {
+        vector1.pop_back();
+      }
+      ASSERT_TRUE(vector1.capacity() <= capacity);
+      ASSERT_TRUE(vector1.capacity() >= vector1.size());
+      reallocations += vector1.capacity() != capacity;
+      capacity = vector1.capacity();
+    }
+    ASSERT_TRUE(reallocations <= 20);
+  }
+}
+
+TEST(vector, copy_assign_releases_oversized) {
+  vector::Vector<int> vector1;
+  vector1.resize(1000);
+  vector::Vector<int> vector2;
+  vector2.push_back(7);
+  vector1 = vector2;
+  ASSERT_TRUE(vector1.size() == 1);
+  ASSERT_TRUE(vector1[0] == 7);
+  ASSERT_TRUE(vector1.capacity() < 1000);
+}
+
+TEST(vector, resize_for_overwrite) {
+  vector::Vector<int> vector1;
+  vector1.push_back(1);
+  vector1.resize_for_overwrite(1000);
+  ASSERT_TRUE(vector1.size() == 1000);
+  ASSERT_TRUE(vector1.capacity() == 1000);
+  ASSERT_TRUE(vector1[0] == 1);
+  vector1[999] = 5;
+  vector1.resize_for_overwrite(2);
+  ASSERT_TRUE(vector1.size() == 2 && vector1[0] == 1);
+
+  vector::Vector<std::string> vector2;
+  vector2.resize_for_overwrite(3);
+  ASSERT_TRUE(vector2[2].empty());
+}
+
+TEST(vector, trivial_element_paths) {
+  static_assert(vector::is_trivially_relocatable_v<int>);
+  static_assert(!vector::is_trivially_relocatable_v<std::string>);
+  static_assert(vector::is_trivially_relocatable_v<vector::Vector<std::string>>);
+
+  vector::Vector<int> vector1;
+  for (int i = 0; i < 5; ++i) {
+    vector1.push_back(i);
+  }
+  vector1.erase(vector1.begin() + 1);
+  vector1.insert(vector1.begin(), vector1[3]);
+  vector::Vector<int> vector2;
+  vector2.push_back(9);
+  vector2 = vector1;
+  ASSERT_TRUE(vector2.size() == 5);
+  ASSERT_TRUE(vector2[0] == 4 && vector2[1] == 0 && vector2[2] == 2 &&
+              vector2[4] == 4);
+
+  vector::Vector<vector::Vector<std::string>> vector3;
+  for (int i = 0; i < 10; ++i) {
+    vector3.emplace_back();
+    vector3[i].push_back(std::string(32, 'a' + i));
+  }
+  vector3.insert(vector3.begin(), vector3[9]);
+  ASSERT_TRUE(vector3.size() == 11);
+  ASSERT_TRUE(vector3[0][0] == std::string(32, 'j'));
+  ASSERT_TRUE(vector3[10][0] == std::string(32, 'j'));
+  ASSERT_TRUE(vector3[1][0] == std::string(32, 'a'));
+}
+
+TEST(vector, checked_access) {
+  vector::Vector<int> vector1;
+  vector1.push_back(1);
+  vector1.push_back(2);
+  ASSERT_TRUE(vector1.at(1) == 2);
+  ASSERT_THROW(vector1.at(2), std::out_of_range);
+  const vector::Vector<int> &vector2 = vector1;
+  ASSERT_THROW(vector2.at(5), std::out_of_range);
+  ASSERT_TRUE(vector2[0] == 1 && vector2.data()[1] == 2);
+  static_assert(noexcept(vector1[0]) == check::kNothrow);
+}
+
+namespace {
+// Копирование бросает после countdown копий, перемещение не noexcept
+struct ThrowingCopy {
+  static inline int countdown = -1;
+  static inline int live = 0;
+  int value;
+  ThrowingCopy(int v) : value(v) { ++live; }
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++live;
+  }
+  ThrowingCopy(ThrowingCopy &&other) : ThrowingCopy(other) {}
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+  ~ThrowingCopy() { --live; }
+};
+} // namespace
+
+TEST(vector, strong_guarantee_on_growth) {
+  {
+    vector::Vector<ThrowingCopy> vector1;
+    vector1.reserve(4);
+    for (int i = 0; i < 4; ++i) {
+      vector1.emplace_back(i);
+    }
+    ThrowingCopy::countdown = 2;
+    ASSERT_THROW(vector1.emplace_back(4), std::runtime_error);
+    ThrowingCopy::countdown = 2;
+    ASSERT_THROW(vector1.insert(vector1.begin() + 1, ThrowingCopy(9)),
+                 std::runtime_error);
+    ThrowingCopy::countdown = -1;
+    ASSERT_TRUE(vector1.size() == 4 && vector1.capacity() == 4);
+    for (int i = 0; i < 4; ++i) {
+      ASSERT_TRUE(vector1[i].value == i);
+    }
+    ASSERT_TRUE(ThrowingCopy::live == 4);
+  }
+  ASSERT_TRUE(ThrowingCopy::live == 0);
+}
+
+namespace {
+// Только перемещение, и оно бросает после countdown перемещений. objects
+// хранит адреса живых объектов: так видны и утечки, и повторное разрушение
+struct ThrowingMoveOnly {
+  static inline int countdown = -1;
+  static inline std::set<const void *> objects;
+  static inline int double_destroyed = 0;
+  int value;
+  ThrowingMoveOnly(int v) : value(v) { objects.insert(this); }
+  ThrowingMoveOnly(ThrowingMoveOnly &&other) : value(other.value) {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw std::runtime_error("move");
+    }
+    objects.insert(this);
+  }
+  ThrowingMoveOnly &operator=(ThrowingMoveOnly &&other) {
+    value = other.value;
+    return *this;
+  }
+  ~ThrowingMoveOnly() { double_destroyed += objects.erase(this) == 0; }
+};
+} // namespace
+
+TEST(vector, basic_guarantee_for_throwing_move_only) {
+  {
+    vector::Vector<ThrowingMoveOnly> vector1;
+    vector1.reserve(4);
+    for (int i = 0; i < 4; ++i) {
+      vector1.emplace_back(i);
+    }
+    // Первый отрезок (один элемент) переносится, второй бросает
+    ThrowingMoveOnly::countdown = 2;
+    ASSERT_THROW(vector1.emplace(vector1.begin() + 1, 9), std::runtime_error);
+    ThrowingMoveOnly::countdown = -1;
+    ASSERT_TRUE(vector1.size() == 4 && vector1.capacity() == 4);
+    ASSERT_TRUE(ThrowingMoveOnly::objects.size() == 4);
+  }
+  ASSERT_TRUE(ThrowingMoveOnly::objects.empty());
+  ASSERT_TRUE(ThrowingMoveOnly::double_destroyed == 0);
+}
@@ -0,0 +1,658 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "vector.hpp"
+
+namespace hash_map {
+
+// Прозрачные хеш и сравнение для строк: поиск по std::string_view и
+// const char* без создания временной std::string
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view value) const noexcept {
+    return std::hash<std::string_view>{}(value);
+  }
+};
+
+struct StringEqual {
+  using is_transparent = void;
+  bool operator()(std::string_view lhs, std::string_view rhs) const noexcept {
+    return lhs == rhs;
+  }
+};
+
+namespace detail {
+
+// Управляющий байт: kEmpty для свободного слота, иначе младшие 7 бит хеша
+constexpr int8_t kEmpty = -128;
+constexpr size_t kGroupWidth = 16;
+
+inline int lowest_bit(uint32_t mask) noexcept {
+#if defined(__GNUC__)
+  return __builtin_ctz(mask);
+#else
+  int bit = 0;
+  while (!(mask & 1u)) {
+    mask >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+// Группа из 16 подряд идущих управляющих байтов, сравниваемых за одну
+// SIMD-инструкцию. Битовая маска результата: бит i — байт i группы
+class Group {
+public:
+  explicit Group(const int8_t *ctrl) noexcept {
+#if defined(__SSE2__)
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#else
+    std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+  }
+
+  uint32_t match(int8_t h2) const noexcept {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+      mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+    }
+    return mask;
+#endif
+  }
+
+  // У свободных слотов установлен старший бит, у занятых — нет
+  uint32_t match_empty() const noexcept {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+    return match(kEmpty);
+#endif
+  }
+
+private:
+#if defined(__SSE2__)
+  __m128i ctrl_;
+#else
+  int8_t ctrl_[kGroupWidth];
+#endif
+};
+
+template <typename T, typename = void>
+struct has_is_transparent : std::false_type {};
+
+template <typename T>
+struct has_is_transparent<T, std::void_t<typename T::is_transparent>>
+    : std::true_type {};
+
+// Гетерогенный поиск включается, только если и хеш, и сравнение прозрачны
+template <typename Hash, typename Eq, typename Key, typename K>
+using EnableHeterogeneous =
+    std::enable_if_t<has_is_transparent<Hash>::value &&
+                     has_is_transparent<Eq>::value &&
+                     !std::is_same_v<std::decay_t<Key>, K>>;
+
+// Перемешивание хеша: std::hash для целых в libstdc++ тождественен, а
+// таблице нужны случайные и старшие, и младшие биты
+inline size_t mix(size_t hash) noexcept {
+  const uint64_t product = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(product ^ (product >> 32));
+}
+
+// Таблица с открытой адресацией и линейным пробированием группами по 16
+// слотов. Policy задаёт тип слота, извлечение ключа и конструирование.
+// Удаление выполняется обратным сдвигом, поэтому «надгробий» нет и цепочка
+// пробирования всегда заканчивается на первом свободном слоте
+template <typename Policy, typename Hash, typename Eq> class Table {
+public:
+  using key_type = typename Policy::key_type;
+  using slot_type = typename Policy::slot_type;
+
+  Table() = default;
+
+  Table(const Hash &hash, const Eq &eq) : hash_(hash), eq_(eq) {}
+
+  // Делегирующий вызов гарантирует деструктор, если копирование слота бросит
+  Table(const Table &other) : Table(other.hash_, other.eq_) {
+    if (other.size_ == 0) {
+      return;
+    }
+    reserve(other.size_);
+    for (size_t i = other.next_full(0); i < other.capacity_;
+         i = other.next_full(i + 1)) {
+      const size_t hash = mix(hash_(Policy::key(other.slot(i))));
+      const size_t index = find_empty(hash);
+      new (slots_.get_address() + index) slot_type(other.slot(i));
+      set_ctrl(index, h2(hash));
+      ++size_;
+    }
+  }
+
+  Table(Table &&other) noexcept { swap(other); }
+
+  Table &operator=(const Table &rhs) {
+    if (this != &rhs) {
+      Table copy(rhs);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  Table &operator=(Table &&rhs) noexcept {
+    swap(rhs);
+    return *this;
+  }
+
+  ~Table() { destroy_slots(); }
+
+  void swap(Table &other) noexcept {
+    ctrl_.swap(other.ctrl_);
+    slots_.swap(other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(hash_, other.hash_);
+    std::swap(eq_, other.eq_);
+  }
+
+  size_t size() const noexcept { return size_; }
+  size_t capacity() const noexcept { return capacity_; }
+
+  slot_type &slot(size_t index) noexcept {
+    return slots_.get_address()[index];
+  }
+  const slot_type &slot(size_t index) const noexcept {
+    return slots_.get_address()[index];
+  }
+
+  // Индекс первого занятого слота не раньше index либо capacity()
+  size_t next_full(size_t index) const noexcept {
+    while (index < capacity_ && ctrl_.get_address()[index] == kEmpty) {
+      ++index;
+    }
+    return index;
+  }
+
+  // Подбирает ёмкость так, чтобы count элементов поместились без рехеширования
+  void reserve(size_t count) {
+    size_t capacity = kGroupWidth;
+    while (capacity * 7 / 8 < count + 1) {
+      capacity *= 2;
+    }
+    if (capacity > capacity_) {
+      rehash(capacity);
+    }
+  }
+
+  void clear() noexcept {
+    destroy_slots();
+    if (capacity_) {
+      std::memset(ctrl_.get_address(), kEmpty,
+                  capacity_ + kGroupWidth - 1);
+    }
+    size_ = 0;
+  }
+
+  template <typename Key> size_t find(const Key &key) const {
+    if (capacity_ == 0) {
+      return 0;
+    }
+    const size_t hash = mix(hash_(key));
+    const size_t mask = capacity_ - 1;
+    const int8_t *ctrl = ctrl_.get_address();
+    size_t position = h1(hash) & mask;
+    while (true) {
+      const Group group(ctrl + position);
+      for (uint32_t match = group.match(h2(hash)); match;
+           match &= match - 1) {
+        const size_t index = (position + lowest_bit(match)) & mask;
+        if (eq_(Policy::key(slot(index)), key)) {
+          return index;
+        }
+      }
+      if (group.match_empty()) {
+        return capacity_;
+      }
+      position = (position + kGroupWidth) & mask;
+    }
+  }
+
+  // Возвращает индекс слота с ключом key и признак того, что слот создан
+  template <typename Key, typename... Args>
+  std::pair<size_t, bool> try_emplace(Key &&key, Args &&...args) {
+    const size_t existing = find(key);
+    if (existing < capacity_) {
+      return {existing, false};
+    }
+    if ((size_ + 1) * 8 > capacity_ * 7) {
+      rehash(capacity_ == 0 ? kGroupWidth : capacity_ * 2);
+    }
+    const size_t hash = mix(hash_(key));
+    const size_t index = find_empty(hash);
+    Policy::construct(slots_.get_address() + index, std::forward<Key>(key),
+                      std::forward<Args>(args)...);
+    set_ctrl(index, h2(hash));
+    ++size_;
+    return {index, true};
+  }
+
+  template <typename Key> size_t erase(const Key &key) {
+    const size_t index = find(key);
+    if (index >= capacity_) {
+      return 0;
+    }
+    erase_at(index);
+    return 1;
+  }
+
+  // Удаляет слот index и сдвигает назад следующие за ним элементы, которые
+  // могут занять освободившееся место, не нарушив свою цепочку пробирования
+  void erase_at(size_t index) {
+    const size_t mask = capacity_ - 1;
+    std::destroy_at(slots_.get_address() + index);
+    --size_;
+    size_t hole = index;
+    for (size_t next = (hole + 1) & mask; ctrl_.get_address()[next] != kEmpty;
+         next = (next + 1) & mask) {
+      const size_t home = h1(mix(hash_(Policy::key(slot(next))))) & mask;
+      if (((next - home) & mask) >= ((next - hole) & mask)) {
+        new (slots_.get_address() + hole) slot_type(std::move(slot(next)));
+        std::destroy_at(slots_.get_address() + next);
+        set_ctrl(hole, ctrl_.get_address()[next]);
+        hole = next;
+      }
+    }
+    set_ctrl(hole, kEmpty);
+  }
+
+private:
+  vector::RawMemory<int8_t> ctrl_;
+  vector::RawMemory<slot_type> slots_;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  Hash hash_;
+  Eq eq_;
+
+  static size_t h1(size_t hash) noexcept { return hash >> 7; }
+  static int8_t h2(size_t hash) noexcept {
+    return static_cast<int8_t>(hash & 0x7f);
+  }
+
+  // Хвост из kGroupWidth - 1 байт повторяет начало массива, чтобы группа,
+  // начинающаяся у конца таблицы, читалась одной загрузкой
+  void set_ctrl(size_t index, int8_t value) noexcept {
+    ctrl_.get_address()[index] = value;
+    if (index < kGroupWidth - 1) {
+      ctrl_.get_address()[capacity_ + index] = value;
+    }
+  }
+
+  size_t find_empty(size_t hash) const noexcept {
+    const size_t mask = capacity_ - 1;
+    size_t position = h1(hash) & mask;
+    while (true) {
+      const Group group(ctrl_.get_address() + position);
+      if (const uint32_t empty = group.match_empty()) {
+        return (position + lowest_bit(empty)) & mask;
+      }
+      position = (position + kGroupWidth) & mask;
+    }
+  }
+
+  void destroy_slots() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<slot_type>) {
+      for (size_t i = next_full(0); i < capacity_; i = next_full(i + 1)) {
+        std::destroy_at(slots_.get_address() + i);
+      }
+    }
+  }
+
+  void rehash(size_t new_capacity) {
+    Table table;
+    vector::RawMemory<int8_t>(new_capacity + kGroupWidth - 1)
+        .swap(table.ctrl_);
+    vector::RawMemory<slot_type>(new_capacity).swap(table.slots_);
+    table.capacity_ = new_capacity;
+    table.hash_ = hash_;
+    table.eq_ = eq_;
+    std::memset(table.ctrl_.get_address(), kEmpty,
+                new_capacity + kGroupWidth - 1);
+
+    for (size_t i = next_full(0); i < capacity_; i = next_full(i + 1)) {
+      const size_t hash = mix(hash_(Policy::key(slot(i))));
+      const size_t index = table.find_empty(hash);
+      new (table.slots_.get_address() + index)
+          slot_type(std::move_if_noexcept(slot(i)));
+      table.set_ctrl(index, h2(hash));
+      ++table.size_;
+    }
+    swap(table);
+  }
+};
+
+// Ссылка на элемент карты: пара ссылок на ключ и значение. Отдельный тип
+// вместо std::pair нужен, чтобы преобразование шло только в сторону
+// value_type, как того требуют концепты итераторов C++20
+template <typename K, typename Value>
+struct PairRef : std::pair<const K &, Value &> {
+  PairRef(const K &key, Value &value) noexcept
+      : std::pair<const K &, Value &>(key, value) {}
+};
+
+template <typename K, typename V> struct MapPolicy {
+  using key_type = K;
+  using slot_type = std::pair<K, V>;
+
+  static const K &key(const slot_type &slot) noexcept { return slot.first; }
+
+  template <typename Key, typename... Args>
+  static void construct(slot_type *slot, Key &&key, Args &&...args) {
+    new (slot) slot_type(std::piecewise_construct,
+                         std::forward_as_tuple(std::forward<Key>(key)),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+};
+
+template <typename K> struct SetPolicy {
+  using key_type = K;
+  using slot_type = K;
+
+  static const K &key(const slot_type &slot) noexcept { return slot; }
+
+  template <typename Key> static void construct(slot_type *slot, Key &&key) {
+    new (slot) slot_type(std::forward<Key>(key));
+  }
+};
+
+} // namespace detail
+
+// Хеш-таблица в стиле Swiss table на RawMemory: управляющие байты и слоты
+// лежат в отдельных массивах, группа из 16 байт проверяется одной
+// SIMD-инструкцией
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename Eq = std::equal_to<K>>
+class HashMap {
+  using Table = detail::Table<detail::MapPolicy<K, V>, Hash, Eq>;
+
+  template <typename Key>
+  using Heterogeneous = detail::EnableHeterogeneous<Hash, Eq, Key, K>;
+
+  template <bool IsConst> class BasicIterator {
+    friend class HashMap;
+    using Owner = std::conditional_t<IsConst, const Table, Table>;
+    using Value = std::conditional_t<IsConst, const V, V>;
+
+    BasicIterator(Owner *table, size_t index) noexcept
+        : table_(table), index_(index) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = std::pair<K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::PairRef<K, Value>;
+    using pointer = void;
+
+    BasicIterator() = default;
+
+    reference operator*() const noexcept {
+      auto &slot = table_->slot(index_);
+      return {slot.first, slot.second};
+    }
+
+    const K &key() const noexcept { return table_->slot(index_).first; }
+    Value &value() const noexcept { return table_->slot(index_).second; }
+
+    BasicIterator &operator++() noexcept {
+      index_ = table_->next_full(index_ + 1);
+      return *this;
+    }
+    BasicIterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++(*this);
+      return old_value;
+    }
+
+    bool operator==(const BasicIterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const BasicIterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+
+  private:
+    Owner *table_ = nullptr;
+    size_t index_ = 0;
+  };
+
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+
+  HashMap() = default;
+
+  HashMap(std::initializer_list<std::pair<K, V>> values) {
+    reserve(values.size());
+    for (const auto &value : values) {
+      insert(value);
+    }
+  }
+
+  iterator begin() noexcept { return iterator(&table_, table_.next_full(0)); }
+  iterator end() noexcept { return iterator(&table_, table_.capacity()); }
+  const_iterator begin() const noexcept {
+    return const_iterator(&table_, table_.next_full(0));
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(&table_, table_.capacity());
+  }
+
+  size_t size() const noexcept { return table_.size(); }
+  bool empty() const noexcept { return table_.size() == 0; }
+  size_t capacity() const noexcept { return table_.capacity(); }
+
+  void reserve(size_t count) { table_.reserve(count); }
+  void clear() noexcept { table_.clear(); }
+  void swap(HashMap &other) noexcept { table_.swap(other.table_); }
+
+  iterator find(const K &key) { return iterator(&table_, table_.find(key)); }
+  const_iterator find(const K &key) const {
+    return const_iterator(&table_, table_.find(key));
+  }
+  template <typename Key, typename = Heterogeneous<Key>>
+  iterator find(const Key &key) {
+    return iterator(&table_, table_.find(key));
+  }
+  template <typename Key, typename = Heterogeneous<Key>>
+  const_iterator find(const Key &key) const {
+    return const_iterator(&table_, table_.find(key));
+  }
+
+  bool contains(const K &key) const { return find(key) != end(); }
+  template <typename Key, typename = Heterogeneous<Key>>
+  bool contains(const Key &key) const {
+    return find(key) != end();
+  }
+
+  V &at(const K &key) {
+    const size_t index = table_.find(key);
+    if (index >= table_.capacity()) {
+      throw std::out_of_range("Key not found");
+    }
+    return table_.slot(index).second;
+  }
+  const V &at(const K &key) const {
+    return const_cast<HashMap &>(*this).at(key);
+  }
+
+  V &operator[](const K &key) { return try_emplace(key).first.value(); }
+  V &operator[](K &&key) {
+    return try_emplace(std::move(key)).first.value();
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+    auto [index, inserted] =
+        table_.try_emplace(key, std::forward<Args>(args)...);
+    return {iterator(&table_, index), inserted};
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args) {
+    auto [index, inserted] =
+        table_.try_emplace(std::move(key), std::forward<Args>(args)...);
+    return {iterator(&table_, index), inserted};
+  }
+
+  std::pair<iterator, bool> insert(const std::pair<K, V> &value) {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(std::pair<K, V> &&value) {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  size_t erase(const K &key) { return table_.erase(key); }
+  template <typename Key, typename = Heterogeneous<Key>>
+  size_t erase(const Key &key) {
+    return table_.erase(key);
+  }
+
+  // Удаление по итератору; обратный сдвиг может переместить в эту позицию
+  // другой элемент, поэтому итераторы после удаления недействительны
+  void erase(const_iterator pos) { table_.erase_at(pos.index_); }
+  void erase(iterator pos) { table_.erase_at(pos.index_); }
+
+private:
+  Table table_;
+};
+
+// Множество на той же таблице, слот хранит только ключ
+template <typename K, typename Hash = std::hash<K>,
+          typename Eq = std::equal_to<K>>
+class HashSet {
+  using Table = detail::Table<detail::SetPolicy<K>, Hash, Eq>;
+
+  template <typename Key>
+  using Heterogeneous = detail::EnableHeterogeneous<Hash, Eq, Key, K>;
+
+public:
+  class const_iterator {
+    friend class HashSet;
+
+    const_iterator(const Table *table, size_t index) noexcept
+        : table_(table), index_(index) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = K;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const K *;
+    using reference = const K &;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept { return table_->slot(index_); }
+    pointer operator->() const noexcept { return &table_->slot(index_); }
+
+    const_iterator &operator++() noexcept {
+      index_ = table_->next_full(index_ + 1);
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++(*this);
+      return old_value;
+    }
+
+    bool operator==(const const_iterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const const_iterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+
+  private:
+    const Table *table_ = nullptr;
+    size_t index_ = 0;
+  };
+
+  using key_type = K;
+  using value_type = K;
+  using iterator = const_iterator;
+
+  HashSet() = default;
+
+  HashSet(std::initializer_list<K> values) {
+    reserve(values.size());
+    for (const K &value : values) {
+      insert(value);
+    }
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(&table_, table_.next_full(0));
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(&table_, table_.capacity());
+  }
+
+  size_t size() const noexcept { return table_.size(); }
+  bool empty() const noexcept { return table_.size() == 0; }
+  size_t capacity() const noexcept { return table_.capacity(); }
+
+  void reserve(size_t count) { table_.reserve(count); }
+  void clear() noexcept { table_.clear(); }
+  void swap(HashSet &other) noexcept { table_.swap(other.table_); }
+
+  const_iterator find(const K &key) const {
+    return const_iterator(&table_, table_.find(key));
+  }
+  template <typename Key, typename = Heterogeneous<Key>>
+  const_iterator find(const Key &key) const {
+    return const_iterator(&table_, table_.find(key));
+  }
+
+  bool contains(const K &key) const { return find(key) != end(); }
+  template <typename Key, typename = Heterogeneous<Key>>
+  bool contains(const Key &key) const {
+    return find(key) != end();
+  }
+
+  std::pair<const_iterator, bool> insert(const K &key) {
+    auto [index, inserted] = table_.try_emplace(key);
+    return {const_iterator(&table_, index), inserted};
+  }
+  std::pair<const_iterator, bool> insert(K &&key) {
+    auto [index, inserted] = table_.try_emplace(std::move(key));
+    return {const_iterator(&table_, index), inserted};
+  }
+
+  size_t erase(const K &key) { return table_.erase(key); }
+  template <typename Key, typename = Heterogeneous<Key>>
+  size_t erase(const Key &key) {
+    return table_.erase(key);
+  }
+
+private:
+  Table table_;
+};
+
+} // end namespace hash_map
@@ -0,0 +1,370 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "check.hpp"
+#include "single_linked_list.hpp"
+#include "static_vector.hpp"
+
+namespace hybrid_list {
+
+// Последовательность с интерфейсом SingleLinkedList. Пока элементов не
+// больше InlineCapacity, они лежат подряд во встроенном буфере внутри
+// объекта: ни одного выделения памяти, обход — проход по массиву. При
+// переполнении буфера или по вызову stabilize() элементы переносятся в
+// SingleLinkedList (все узлы одним блоком) и дальше список ведёт себя как
+// обычный связный. В режиме буфера вставка и удаление делают итераторы
+// недействительными, в связном режиме — только итератор на удалённый элемент
+template <typename Type, size_t InlineCapacity = 32>
+class HybridList {
+  using Buffer =
+      static_vector::StaticVector<Type, InlineCapacity,
+                                  static_vector::CheckedOverflow>;
+  using List = single_linked_list::SingleLinkedList<Type>;
+
+  // Итератор обоих режимов. В режиме буфера buffer_ указывает на буфер, а
+  // position_ — номер элемента, увеличенный на единицу (0 — позиция перед
+  // первым элементом). В связном режиме buffer_ пуст, позицию задаёт node_
+  template <typename ValueType>
+  class BasicIterator {
+    friend class HybridList;
+    template <typename> friend class BasicIterator;
+
+    static constexpr bool kConst = std::is_const_v<ValueType>;
+    using BufferPointer = std::conditional_t<kConst, const Buffer *, Buffer *>;
+    using ListIterator = std::conditional_t<kConst, typename List::ConstIterator,
+                                            typename List::Iterator>;
+
+    BasicIterator(BufferPointer buffer, size_t position) noexcept
+        : buffer_(buffer), position_(position) {}
+
+    explicit BasicIterator(ListIterator node) noexcept : node_(node) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    // Копирование Iterator и преобразование Iterator в ConstIterator
+    BasicIterator(const BasicIterator<Type> &other) noexcept
+        : buffer_(other.buffer_),
+          position_(other.position_),
+          node_(other.node_) {}
+
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    template <typename Other>
+    [[nodiscard]] bool operator==(
+        const BasicIterator<Other> &rhs) const noexcept {
+      return position_ == rhs.position_ && node_ == rhs.node_;
+    }
+
+    template <typename Other>
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<Other> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    BasicIterator &operator++() noexcept {
+      if (buffer_) {
+        ++position_;
+      } else {
+        ++node_;
+      }
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++(*this);
+      return old_value;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+      return buffer_ ? (*buffer_)[position_ - 1] : *node_;
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept { return &**this; }
+
+   private:
+    BufferPointer buffer_ = nullptr;
+    size_t position_ = 0;
+    ListIterator node_;
+  };
+
+ public:
+  using value_type = Type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using Iterator = BasicIterator<Type>;
+  using ConstIterator = BasicIterator<const Type>;
+
+  // Число элементов, которое помещается во встроенный буфер
+  static constexpr size_t inline_capacity() noexcept { return InlineCapacity; }
+
+  HybridList() = default;
+
+  HybridList(std::initializer_list<Type> values) {
+    if (values.size() <= InlineCapacity) {
+      for (const Type &value : values) {
+        buffer_.push_back(value);
+      }
+    } else {
+      list_.init(values.begin(), values.end());
+      linked_ = true;
+    }
+  }
+
+  HybridList(const HybridList &other) = default;
+  // Как и у SingleLinkedList, перемещение оставляет источник пустым
+  HybridList(HybridList &&other) noexcept(
+      std::is_nothrow_swappable_v<Buffer>) {
+    swap(other);
+  }
+
+  HybridList &operator=(const HybridList &rhs) {
+    if (this != &rhs) {
+      HybridList temp(rhs);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  HybridList &operator=(HybridList &&rhs) noexcept(
+      std::is_nothrow_swappable_v<Buffer>) {
+    swap(rhs);
+    return *this;
+  }
+
+  [[nodiscard]] Iterator begin() noexcept {
+    return linked_ ? Iterator(list_.begin()) : Iterator(&buffer_, 1);
+  }
+  [[nodiscard]] Iterator end() noexcept {
+    return linked_ ? Iterator(list_.end())
+                   : Iterator(&buffer_, buffer_.size() + 1);
+  }
+  [[nodiscard]] ConstIterator begin() const noexcept { return cbegin(); }
+  [[nodiscard]] ConstIterator end() const noexcept { return cend(); }
+  [[nodiscard]] ConstIterator cbegin() const noexcept {
+    return linked_ ? ConstIterator(list_.cbegin()) : ConstIterator(&buffer_, 1);
+  }
+  [[nodiscard]] ConstIterator cend() const noexcept {
+    return linked_ ? ConstIterator(list_.cend())
+                   : ConstIterator(&buffer_, buffer_.size() + 1);
+  }
+
+  // Позиция перед первым элементом, разыменовывать нельзя
+  [[nodiscard]] Iterator before_begin() noexcept {
+    return linked_ ? Iterator(list_.before_begin()) : Iterator(&buffer_, 0);
+  }
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return linked_ ? ConstIterator(list_.cbefore_begin())
+                   : ConstIterator(&buffer_, 0);
+  }
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return cbefore_begin();
+  }
+
+  [[nodiscard]] size_t size() const noexcept {
+    return linked_ ? list_.size() : buffer_.size();
+  }
+
+  [[nodiscard]] bool is_empty() const noexcept { return size() == 0; }
+
+  // Элементы хранятся в связном списке
+  [[nodiscard]] bool is_linked() const noexcept { return linked_; }
+
+  // Объект вместе со встроенным буфером плюс узлы связного режима
+  [[nodiscard]] size_t memory_usage() const noexcept {
+    return sizeof(*this) - sizeof(list_) + list_.memory_usage();
+  }
+
+  // Проверка индекса зависит от CONTAINERS_CHECK_LEVEL (check.hpp)
+  Type &operator[](const size_t index) noexcept(check::kNothrow) {
+    check::require(index < size(), "Index");
+    return linked_ ? list_[index] : buffer_[index];
+  }
+
+  // Индекс проверяется всегда, при выходе за размер — std::out_of_range
+  Type &at(const size_t index) {
+    check::always(index < size(), "Index");
+    return linked_ ? list_[index] : buffer_[index];
+  }
+
+  void swap(HybridList &other) noexcept(std::is_nothrow_swappable_v<Buffer>) {
+    std::swap(buffer_, other.buffer_);
+    list_.swap(other.list_);
+    std::swap(linked_, other.linked_);
+  }
+
+  void push_front(const Type &value) {
+    if (!linked_ && !buffer_.full()) {
+      buffer_.insert(buffer_.begin(), value);
+      return;
+    }
+    stabilize();
+    list_.push_front(value);
+  }
+
+  void push_back(const Type &value) {
+    if (!linked_ && buffer_.push_back(value)) {
+      return;
+    }
+    stabilize();
+    list_.push_back(value);
+  }
+
+  // Вставляет value после pos и возвращает итератор на вставленный элемент.
+  // Если буфер заполнен, список сначала переходит в связный режим
+  Iterator insert(ConstIterator pos, const Type &value) {
+    if (!linked_) {
+      if (pos.position_ > buffer_.size()) {
+        return end();
+      }
+      if (!buffer_.full()) {
+        buffer_.insert(buffer_.begin() + pos.position_, value);
+        return Iterator(&buffer_, pos.position_ + 1);
+      }
+      const size_t position = pos.position_;
+      stabilize();
+      pos = cbefore_begin();
+      std::advance(pos, position);
+    }
+    return Iterator(list_.insert(pos.node_, value));
+  }
+
+  void pop_front() noexcept {
+    if (linked_) {
+      list_.pop_front();
+    } else if (!buffer_.empty()) {
+      buffer_.erase(buffer_.begin());
+    }
+  }
+
+  // Удаляет элемент, следующий за pos, и возвращает итератор на элемент за
+  // удалённым. Связный список обратно в буфер не возвращается
+  Iterator erase(ConstIterator pos) noexcept {
+    if (linked_) {
+      return Iterator(list_.erase(pos.node_));
+    }
+    if (pos.position_ >= buffer_.size()) {
+      return end();
+    }
+    buffer_.erase(buffer_.begin() + pos.position_);
+    return Iterator(&buffer_, pos.position_ + 1);
+  }
+
+  // Очищает список; пустой список снова хранит элементы в буфере
+  void clear() noexcept {
+    buffer_.clear();
+    list_.clear();
+    linked_ = false;
+  }
+
+  // Переводит список в связный режим: после этого итераторы переживают
+  // вставки и удаление других элементов. Элементы буфера переносятся в
+  // узлы одного блока; если перенос бросит исключение, список не меняется
+  void stabilize() {
+    if (linked_) {
+      return;
+    }
+    List list;
+    if constexpr (std::is_nothrow_move_constructible_v<Type>) {
+      list.init(std::make_move_iterator(buffer_.begin()),
+                std::make_move_iterator(buffer_.end()));
+    } else {
+      list.init(buffer_.cbegin(), buffer_.cend());
+    }
+    list_.swap(list);
+    buffer_.clear();
+    linked_ = true;
+  }
+
+  template <typename F>
+  void for_each(F f) {
+    if (linked_) {
+      list_.for_each(f);
+    } else {
+      std::for_each(buffer_.begin(), buffer_.end(), f);
+    }
+  }
+
+  template <typename T, typename Reduce, typename Transform>
+  T transform_reduce(T init, Reduce reduce, Transform transform) {
+    for_each([&](Type &value) {
+      init = reduce(std::move(init), transform(value));
+    });
+    return init;
+  }
+
+  void print() {
+    if (is_empty()) {
+      std::cout << "Hybrid list is empty" << std::endl;
+      return;
+    }
+    for (auto it = begin(); it != end(); ++it) {
+      std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+  }
+
+ private:
+  Buffer buffer_;
+  List list_;
+  bool linked_ = false;
+};
+
+template <typename Type, size_t N>
+void swap(HybridList<Type, N> &lhs,
+          HybridList<Type, N> &rhs) noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+template <typename Type, size_t N>
+bool operator==(const HybridList<Type, N> &lhs,
+                const HybridList<Type, N> &rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N>
+bool operator!=(const HybridList<Type, N> &lhs,
+                const HybridList<Type, N> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+bool operator<(const HybridList<Type, N> &lhs,
+               const HybridList<Type, N> &rhs) {
+  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end());
+}
+
+template <typename Type, size_t N>
+bool operator<=(const HybridList<Type, N> &lhs,
+                const HybridList<Type, N> &rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+bool operator>(const HybridList<Type, N> &lhs,
+               const HybridList<Type, N> &rhs) {
+  return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+bool operator>=(const HybridList<Type, N> &lhs,
+                const HybridList<Type, N> &rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace hybrid_list
@@ -0,0 +1,521 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "chunked_deque.hpp"
+#include "vector.hpp"
+
+namespace parallel {
+
+class TaskGroup;
+
+// Пул потоков с перехватом работы. У каждого рабочего потока своя очередь:
+// он берёт задачи с её конца, а простаивающие потоки забирают самые старые
+// задачи из начала чужих очередей. Поток, ожидающий TaskGroup, тоже
+// выполняет задачи, поэтому вложенный параллелизм не блокирует пул
+class ThreadPool {
+  friend class TaskGroup;
+  using Task = std::function<void()>;
+
+  struct Queue {
+    std::mutex mutex;
+    chunked_deque::ChunkedDeque<Task> tasks;
+  };
+
+public:
+  // concurrency — общее число потоков вместе с вызывающим: пул запускает
+  // concurrency - 1 рабочих, вызывающий поток помогает им в TaskGroup::wait
+  explicit ThreadPool(size_t concurrency = std::thread::hardware_concurrency())
+      : concurrency_(std::max<size_t>(concurrency, 1)) {
+    queues_.reserve(concurrency_);
+    for (size_t i = 0; i < concurrency_; ++i) {
+      queues_.push_back(std::make_unique<Queue>());
+    }
+    workers_.reserve(concurrency_ - 1);
+    try {
+      for (size_t i = 1; i < concurrency_; ++i) {
+        workers_.emplace_back([this, i] { work(i); });
+      }
+    } catch (...) {
+      stop();
+      throw;
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() { stop(); }
+
+  size_t size() const noexcept { return concurrency_; }
+
+  // Выполняет одну задачу из очередей пула; false — задач нет
+  bool try_run_one() {
+    Task task;
+    if (!take(current_index(), task)) {
+      return false;
+    }
+    task();
+    return true;
+  }
+
+private:
+  size_t concurrency_;
+  vector::Vector<std::unique_ptr<Queue>> queues_;
+  vector::Vector<std::thread> workers_;
+  std::atomic<size_t> pending_{0};
+  std::atomic<bool> stopping_{false};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+
+  struct Current {
+    const ThreadPool *pool = nullptr;
+    size_t index = 0;
+  };
+
+  static Current &current() noexcept {
+    thread_local Current current;
+    return current;
+  }
+
+  // Очередь вызывающего потока: собственная у рабочего, нулевая у остальных
+  size_t current_index() const noexcept {
+    return current().pool == this ? current().index : 0;
+  }
+
+  void submit(Task task) {
+    Queue &queue = *queues_[current_index()];
+    // Счётчик увеличивается до вставки, чтобы не опуститься ниже нуля,
+    // если задачу заберут раньше, чем вставка вернёт управление
+    pending_.fetch_add(1, std::memory_order_release);
+    try {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(std::move(task));
+    } catch (...) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      throw;
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_one();
+  }
+
+  bool take(size_t own, Task &task) {
+    if (pending_.load(std::memory_order_acquire) == 0) {
+      return false;
+    }
+    {
+      Queue &queue = *queues_[own];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    for (size_t shift = 1; shift < concurrency_; ++shift) {
+      Queue &queue = *queues_[(own + shift) % concurrency_];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void work(size_t index) {
+    current() = Current{this, index};
+    Task task;
+    while (true) {
+      if (take(index, task)) {
+        task();
+        task = nullptr;
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this] {
+        return stopping_.load() || pending_.load(std::memory_order_acquire);
+      });
+      if (stopping_.load()) {
+        return;
+      }
+    }
+  }
+
+  void stop() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+    workers_.clear();
+  }
+};
+
+// Группа задач для fork-join: run ставит задачу в пул, wait дожидается
+// всех задач группы, выполняя тем временем задачи пула. Первое исключение
+// из задач группы пробрасывается из wait
+class TaskGroup {
+public:
+  explicit TaskGroup(ThreadPool &pool) noexcept : pool_(pool) {}
+
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+  ~TaskGroup() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+      help();
+    }
+  }
+
+  template <typename F> void run(F f) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    try {
+      pool_.submit([this, f = std::move(f)]() mutable {
+        try {
+          f();
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex_);
+          if (!error_) {
+            error_ = std::current_exception();
+          }
+        }
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+      });
+    } catch (...) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      throw;
+    }
+  }
+
+  void wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+      help();
+    }
+    if (error_) {
+      std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+  }
+
+private:
+  ThreadPool &pool_;
+  std::atomic<size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  void help() {
+    if (!pool_.try_run_one()) {
+      std::this_thread::yield();
+    }
+  }
+};
+
+namespace detail {
+
+constexpr size_t kMinGrain = 2048;
+
+// Размер порции по умолчанию: около восьми порций на поток, чтобы было что
+// перехватывать при неравномерной нагрузке
+inline size_t grain_for(size_t size, const ThreadPool &pool, size_t grain) {
+  if (grain != 0) {
+    return grain;
+  }
+  return std::max(kMinGrain, size / (pool.size() * 8) + 1);
+}
+
+template <typename Body>
+void split(TaskGroup &group, size_t begin, size_t end, size_t grain,
+           const Body &body) {
+  while (end - begin > grain) {
+    const size_t middle = begin + (end - begin) / 2;
+    group.run([&group, middle, end, grain, &body] {
+      split(group, middle, end, grain, body);
+    });
+    end = middle;
+  }
+  body(begin, end);
+}
+
+} // namespace detail
+
+// Вызывает body(begin, end) для порций диапазона индексов [begin, end)
+// размером не больше grain; grain == 0 — размер выбирается по числу потоков
+template <typename Body>
+void for_range(ThreadPool &pool, size_t begin, size_t end, const Body &body,
+               size_t grain = 0) {
+  if (begin >= end) {
+    return;
+  }
+  grain = detail::grain_for(end - begin, pool, grain);
+  if (end - begin <= grain) {
+    body(begin, end);
+    return;
+  }
+  TaskGroup group(pool);
+  detail::split(group, begin, end, grain, body);
+  group.wait();
+}
+
+template <typename RandomIt, typename F>
+void for_each(ThreadPool &pool, RandomIt first, RandomIt last, F f,
+              size_t grain = 0) {
+  for_range(
+      pool, 0, last - first,
+      [first, &f](size_t begin, size_t end) {
+        std::for_each(first + begin, first + end, f);
+      },
+      grain);
+}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOp>
+OutputIt transform(ThreadPool &pool, RandomIt first, RandomIt last,
+                   OutputIt out, UnaryOp op, size_t grain = 0) {
+  for_range(
+      pool, 0, last - first,
+      [first, out, &op](size_t begin, size_t end) {
+        std::transform(first + begin, first + end, out + begin, op);
+      },
+      grain);
+  return out + (last - first);
+}
+
+// Свёртка по порциям: op должна быть ассоциативной, init участвует один раз.
+// T должен быть конструируемым по умолчанию (для частичных сумм)
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T reduce(ThreadPool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op = {}, size_t grain = 0) {
+  const size_t size = last - first;
+  if (size == 0) {
+    return init;
+  }
+  grain = detail::grain_for(size, pool, grain);
+  const size_t chunks = (size + grain - 1) / grain;
+  vector::Vector<T> partial(chunks);
+  for_range(
+      pool, 0, chunks,
+      [&](size_t begin, size_t end) {
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+          RandomIt from = first + chunk * grain;
+          RandomIt to = first + std::min(size, (chunk + 1) * grain);
+          T sum = *from;
+          for (++from; from != to; ++from) {
+            sum = op(std::move(sum), *from);
+          }
+          partial[chunk] = std::move(sum);
+        }
+      },
+      1);
+  for (T &sum : partial) {
+    init = op(std::move(init), std::move(sum));
+  }
+  return init;
+}
+
+// Включающий префиксный проход в два этапа: суммы порций, затем проход
+// внутри каждой порции со смещением от предыдущих
+template <typename RandomIt, typename OutputIt, typename BinaryOp = std::plus<>>
+OutputIt inclusive_scan(ThreadPool &pool, RandomIt first, RandomIt last,
+                        OutputIt out, BinaryOp op = {}, size_t grain = 0) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  const size_t size = last - first;
+  if (size == 0) {
+    return out;
+  }
+  grain = detail::grain_for(size, pool, grain);
+  const size_t chunks = (size + grain - 1) / grain;
+  vector::Vector<T> offsets(chunks);
+  for_range(
+      pool, 0, chunks - 1,
+      [&](size_t begin, size_t end) {
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+          RandomIt from = first + chunk * grain;
+          RandomIt to = from + grain;
+          T sum = *from;
+          for (++from; from != to; ++from) {
+            sum = op(std::move(sum), *from);
+          }
+          offsets[chunk] = std::move(sum);
+        }
+      },
+      1);
+  for (size_t chunk = 1; chunk + 1 < chunks; ++chunk) {
+    offsets[chunk] = op(offsets[chunk - 1], offsets[chunk]);
+  }
+  for_range(
+      pool, 0, chunks,
+      [&](size_t begin, size_t end) {
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+          RandomIt from = first + chunk * grain;
+          RandomIt to = first + std::min(size, (chunk + 1) * grain);
+          OutputIt dest = out + chunk * grain;
+          T sum = chunk == 0 ? T(*from) : op(offsets[chunk - 1], *from);
+          *dest = sum;
+          for (++from, ++dest; from != to; ++from, ++dest) {
+            sum = op(std::move(sum), *from);
+            *dest = sum;
+          }
+        }
+      },
+      1);
+  return out + size;
+}
+
+namespace detail {
+
+// Слияние двух отсортированных диапазонов в out: середина большего
+// диапазона делит меньший двоичным поиском, половины сливаются параллельно.
+// Два элемента и меньше сливаются сразу при любом grain: иначе деление
+// диапазона из одного элемента порождает задачу, равную исходной
+template <typename It, typename OutIt, typename Compare>
+void merge(TaskGroup &group, It first1, It last1, It first2, It last2,
+           OutIt out, const Compare &comp, size_t grain) {
+  while (true) {
+    const size_t size1 = last1 - first1;
+    const size_t size2 = last2 - first2;
+    if (size1 + size2 <= std::max<size_t>(grain, 2)) {
+      std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                 std::make_move_iterator(first2), std::make_move_iterator(last2),
+                 out, comp);
+      return;
+    }
+    It middle1;
+    It middle2;
+    if (size1 >= size2) {
+      middle1 = first1 + size1 / 2;
+      middle2 = std::lower_bound(first2, last2, *middle1, comp);
+    } else {
+      middle2 = first2 + size2 / 2;
+      middle1 = std::upper_bound(first1, last1, *middle2, comp);
+    }
+    OutIt out_middle = out + (middle1 - first1) + (middle2 - first2);
+    group.run([&group, middle1, last1, middle2, last2, out_middle, &comp,
+               grain] {
+      merge(group, middle1, last1, middle2, last2, out_middle, comp, grain);
+    });
+    last1 = middle1;
+    last2 = middle2;
+  }
+}
+
+// Сортирует [first, last), используя buffer того же размера
+template <typename It, typename BufIt, typename Compare>
+void sort(ThreadPool &pool, It first, It last, BufIt buffer,
+          const Compare &comp, size_t grain) {
+  const size_t size = last - first;
+  if (size <= grain) {
+    std::sort(first, last, comp);
+    return;
+  }
+  const size_t half = size / 2;
+  {
+    TaskGroup group(pool);
+    group.run([&] { sort(pool, first, first + half, buffer, comp, grain); });
+    sort(pool, first + half, last, buffer + half, comp, grain);
+    group.wait();
+  }
+  {
+    TaskGroup group(pool);
+    merge(group, first, first + half, first + half, last, buffer, comp, grain);
+    group.wait();
+  }
+  for_range(
+      pool, 0, size,
+      [first, buffer](size_t begin, size_t end) {
+        std::move(buffer + begin, buffer + end, first + begin);
+      },
+      grain);
+}
+
+} // namespace detail
+
+// Параллельная сортировка слиянием; T должен быть конструируемым по
+// умолчанию (для буфера слияния). Порядок равных элементов не сохраняется
+template <typename RandomIt, typename Compare = std::less<>>
+void sort(ThreadPool &pool, RandomIt first, RandomIt last, Compare comp = {},
+          size_t grain = 0) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  const size_t size = last - first;
+  grain = detail::grain_for(size, pool, grain);
+  if (size <= grain) {
+    std::sort(first, last, comp);
+    return;
+  }
+  vector::Vector<T> buffer(size);
+  detail::sort(pool, first, last, buffer.begin(), comp, grain);
+}
+
+// Устойчивое разбиение: элементы, для которых pred истинен, перемещаются в
+// начало с сохранением порядка. Возвращает границу разбиения. Тип элементов
+// должен быть конструируемым по умолчанию (для промежуточного буфера)
+template <typename RandomIt, typename Predicate>
+RandomIt partition(ThreadPool &pool, RandomIt first, RandomIt last,
+                   Predicate pred, size_t grain = 0) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  const size_t size = last - first;
+  if (size == 0) {
+    return first;
+  }
+  grain = detail::grain_for(size, pool, grain);
+  const size_t chunks = (size + grain - 1) / grain;
+  // Флаги считаются один раз: pred может быть дорогим
+  vector::Vector<unsigned char> flags(size);
+  vector::Vector<size_t> selected(chunks + 1);
+  for_range(
+      pool, 0, chunks,
+      [&](size_t begin, size_t end) {
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+          size_t count = 0;
+          for (size_t i = chunk * grain;
+               i < std::min(size, (chunk + 1) * grain); ++i) {
+            flags[i] = pred(first[i]) ? 1 : 0;
+            count += flags[i];
+          }
+          selected[chunk + 1] = count;
+        }
+      },
+      1);
+  for (size_t chunk = 1; chunk <= chunks; ++chunk) {
+    selected[chunk] += selected[chunk - 1];
+  }
+  const size_t boundary = selected[chunks];
+  vector::Vector<T> buffer(size);
+  for_range(
+      pool, 0, chunks,
+      [&](size_t begin, size_t end) {
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+          size_t accepted = selected[chunk];
+          size_t rejected = boundary + chunk * grain - selected[chunk];
+          for (size_t i = chunk * grain;
+               i < std::min(size, (chunk + 1) * grain); ++i) {
+            buffer[flags[i] ? accepted++ : rejected++] = std::move(first[i]);
+          }
+        }
+      },
+      1);
+  for_range(
+      pool, 0, size,
+      [&](size_t begin, size_t end) {
+        std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+      },
+      grain);
+  return first + boundary;
+}
+
+} // end namespace parallel
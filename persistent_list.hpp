@@ -0,0 +1,163 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace persistent_list {
+
+// Неизменяемый односвязный список. Версии разделяют общие хвосты: узел
+// хранит атомарный счётчик ссылок и освобождается вместе с последней
+// ссылающейся на него версией. push_front и pop_front создают новую версию
+// за O(1), не затрагивая исходную
+template <typename T> class PersistentList {
+  struct Node {
+    Node(const T &val, Node *next) : value(val), next_node(next) {}
+
+    std::atomic<size_t> refs{1};
+    T value;
+    Node *next_node = nullptr;
+  };
+
+public:
+  using value_type = T;
+
+  class const_iterator {
+    friend class PersistentList;
+
+    explicit const_iterator(const Node *node) noexcept : node_(node) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept { return node_->value; }
+    pointer operator->() const noexcept { return &node_->value; }
+
+    const_iterator &operator++() noexcept {
+      node_ = node_->next_node;
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      auto old_value(*this);
+      node_ = node_->next_node;
+      return old_value;
+    }
+
+    bool operator==(const const_iterator &rhs) const noexcept {
+      return node_ == rhs.node_;
+    }
+    bool operator!=(const const_iterator &rhs) const noexcept {
+      return node_ != rhs.node_;
+    }
+
+  private:
+    const Node *node_ = nullptr;
+  };
+
+  PersistentList() = default;
+
+  PersistentList(std::initializer_list<T> values) {
+    for (auto it = std::rbegin(values); it != std::rend(values); ++it) {
+      head_ = new Node(*it, head_);
+      ++size_;
+    }
+  }
+
+  PersistentList(const PersistentList &other) noexcept
+      : head_(retain(other.head_)), size_(other.size_) {}
+
+  PersistentList(PersistentList &&other) noexcept
+      : head_(std::exchange(other.head_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  PersistentList &operator=(PersistentList rhs) noexcept {
+    swap(rhs);
+    return *this;
+  }
+
+  ~PersistentList() { release(head_); }
+
+  const_iterator begin() const noexcept { return const_iterator(head_); }
+  const_iterator end() const noexcept { return const_iterator(nullptr); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const T &front() const {
+    if (!head_) {
+      throw std::out_of_range("List is empty");
+    }
+    return head_->value;
+  }
+
+  // Новая версия с value в начале; хвост разделяется с текущей версией
+  [[nodiscard]] PersistentList push_front(const T &value) const {
+    Node *node = new Node(value, head_);
+    retain(head_);
+    return PersistentList(node, size_ + 1);
+  }
+
+  // Новая версия без первого элемента
+  [[nodiscard]] PersistentList pop_front() const {
+    if (!head_) {
+      return *this;
+    }
+    return PersistentList(retain(head_->next_node), size_ - 1);
+  }
+
+  void swap(PersistentList &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+  // Версии с общим первым узлом совпадают целиком
+  bool shares_with(const PersistentList &other) const noexcept {
+    return head_ == other.head_;
+  }
+
+private:
+  Node *head_ = nullptr;
+  size_t size_ = 0;
+
+  PersistentList(Node *head, size_t size) noexcept : head_(head), size_(size) {}
+
+  static Node *retain(Node *node) noexcept {
+    if (node) {
+      node->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+  }
+
+  // Освобождение цепочки циклом, а не рекурсией: длинный список не
+  // переполняет стек
+  static void release(Node *node) noexcept {
+    while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete std::exchange(node, node->next_node);
+    }
+  }
+};
+
+template <typename T>
+bool operator==(const PersistentList<T> &lhs, const PersistentList<T> &rhs) {
+  return lhs.size() == rhs.size() &&
+         (lhs.shares_with(rhs) ||
+          std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <typename T>
+bool operator!=(const PersistentList<T> &lhs, const PersistentList<T> &rhs) {
+  return !(lhs == rhs);
+}
+
+} // end namespace persistent_list
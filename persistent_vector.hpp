@@ -0,0 +1,364 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "static_vector.hpp"
+
+namespace persistent_vector {
+
+// Неизменяемый вектор на 32-арном префиксном дереве с хвостовым буфером.
+// Последние до 32 элементов лежат в отдельном листе-хвосте, поэтому
+// push_back обычно копирует только его; запись в середину копирует путь от
+// корня до листа — O(log32 n) узлов. Остальные узлы разделяются между
+// версиями через атомарные счётчики ссылок.
+// Пакетные изменения выполняет Transient: узлы, принадлежащие только ему,
+// изменяются на месте
+template <typename T> class PersistentVector {
+  static constexpr unsigned kBits = 5;
+  static constexpr size_t kBranching = size_t{1} << kBits;
+  static constexpr size_t kMask = kBranching - 1;
+
+  struct NodeBase {
+    NodeBase() = default;
+    NodeBase(const NodeBase &) noexcept {}
+
+    std::atomic<size_t> refs{1};
+  };
+
+  struct Branch : NodeBase {
+    NodeBase *children[kBranching] = {};
+  };
+
+  struct Leaf : NodeBase {
+    static_vector::StaticVector<T, kBranching> values;
+  };
+
+public:
+  using value_type = T;
+
+  class const_iterator {
+    friend class PersistentVector;
+
+    const_iterator(const PersistentVector *owner, size_t index) noexcept
+        : owner_(owner), index_(index) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+    pointer operator->() const noexcept { return &(*owner_)[index_]; }
+
+    const_iterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++index_;
+      return old_value;
+    }
+
+    bool operator==(const const_iterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const const_iterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+
+  private:
+    const PersistentVector *owner_ = nullptr;
+    size_t index_ = 0;
+  };
+
+  // Изменяемая обёртка для пакетных изменений. Первое изменение узла
+  // копирует его, последующие выполняются на месте
+  class Transient {
+  public:
+    explicit Transient(PersistentVector base) noexcept
+        : vector_(std::move(base)) {}
+
+    size_t size() const noexcept { return vector_.size(); }
+    const T &operator[](size_t index) const noexcept { return vector_[index]; }
+
+    void push_back(const T &value) { vector_.push_back_in_place(value); }
+    void set(size_t index, const T &value) {
+      vector_.set_in_place(index, value);
+    }
+    void pop_back() { vector_.pop_back_in_place(); }
+
+    // Завершает пакет и возвращает готовую версию
+    PersistentVector persistent() && { return std::move(vector_); }
+
+  private:
+    PersistentVector vector_;
+  };
+
+  PersistentVector() = default;
+
+  PersistentVector(std::initializer_list<T> values) {
+    for (const T &value : values) {
+      push_back_in_place(value);
+    }
+  }
+
+  PersistentVector(const PersistentVector &other) noexcept
+      : size_(other.size_), shift_(other.shift_), root_(retain(other.root_)),
+        tail_(retain(other.tail_)) {}
+
+  PersistentVector(PersistentVector &&other) noexcept
+      : size_(std::exchange(other.size_, 0)),
+        shift_(std::exchange(other.shift_, kBits)),
+        root_(std::exchange(other.root_, nullptr)),
+        tail_(std::exchange(other.tail_, nullptr)) {}
+
+  PersistentVector &operator=(PersistentVector rhs) noexcept {
+    swap(rhs);
+    return *this;
+  }
+
+  ~PersistentVector() {
+    release(root_, shift_);
+    release(tail_, 0);
+  }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const T &operator[](size_t index) const noexcept {
+    return leaf_for(index)->values[index & kMask];
+  }
+
+  const T &at(size_t index) const {
+    if (index >= size_) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    return (*this)[index];
+  }
+
+  [[nodiscard]] PersistentVector push_back(const T &value) const {
+    PersistentVector result(*this);
+    result.push_back_in_place(value);
+    return result;
+  }
+
+  [[nodiscard]] PersistentVector set(size_t index, const T &value) const {
+    PersistentVector result(*this);
+    result.set_in_place(index, value);
+    return result;
+  }
+
+  [[nodiscard]] PersistentVector pop_back() const {
+    PersistentVector result(*this);
+    result.pop_back_in_place();
+    return result;
+  }
+
+  Transient transient() const noexcept { return Transient(*this); }
+
+  void swap(PersistentVector &other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(shift_, other.shift_);
+    std::swap(root_, other.root_);
+    std::swap(tail_, other.tail_);
+  }
+
+private:
+  size_t size_ = 0;
+  unsigned shift_ = kBits;
+  NodeBase *root_ = nullptr;
+  NodeBase *tail_ = nullptr;
+
+  static NodeBase *retain(NodeBase *node) noexcept {
+    if (node) {
+      node->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+  }
+
+  // level — высота узла: 0 у листьев, kBits у родителей листьев и т.д.
+  static void release(NodeBase *node, unsigned level) noexcept {
+    if (!node || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    if (level == 0) {
+      delete static_cast<Leaf *>(node);
+      return;
+    }
+    Branch *branch = static_cast<Branch *>(node);
+    for (NodeBase *child : branch->children) {
+      release(child, level - kBits);
+    }
+    delete branch;
+  }
+
+  // Узел в slot становится собственным: разделяемый узел заменяется копией
+  static Branch *unique_branch(NodeBase *&slot, unsigned level) {
+    if (!slot) {
+      slot = new Branch();
+    } else if (slot->refs.load(std::memory_order_acquire) != 1) {
+      Branch *copy = new Branch(*static_cast<Branch *>(slot));
+      for (NodeBase *child : copy->children) {
+        retain(child);
+      }
+      release(std::exchange(slot, copy), level);
+    }
+    return static_cast<Branch *>(slot);
+  }
+
+  static Leaf *unique_leaf(NodeBase *&slot) {
+    if (!slot) {
+      slot = new Leaf();
+    } else if (slot->refs.load(std::memory_order_acquire) != 1) {
+      Leaf *copy = new Leaf(*static_cast<Leaf *>(slot));
+      release(std::exchange(slot, copy), 0);
+    }
+    return static_cast<Leaf *>(slot);
+  }
+
+  // Индекс первого элемента хвоста
+  size_t tail_offset() const noexcept {
+    return size_ < kBranching ? 0 : ((size_ - 1) >> kBits) << kBits;
+  }
+
+  const Leaf *leaf_for(size_t index) const noexcept {
+    if (index >= tail_offset()) {
+      return static_cast<const Leaf *>(tail_);
+    }
+    const NodeBase *node = root_;
+    for (unsigned level = shift_; level > 0; level -= kBits) {
+      node = static_cast<const Branch *>(node)->children[(index >> level) &
+                                                         kMask];
+    }
+    return static_cast<const Leaf *>(node);
+  }
+
+  void push_back_in_place(const T &value) {
+    if (size_ - tail_offset() < kBranching) {
+      unique_leaf(tail_)->values.push_back(value);
+      ++size_;
+      return;
+    }
+    // Хвост заполнен: он уходит в дерево, значение открывает новый хвост
+    NodeBase *fresh = new Leaf();
+    try {
+      static_cast<Leaf *>(fresh)->values.push_back(value);
+      if (root_ && (size_ >> kBits) > (size_t{1} << shift_)) {
+        Branch *new_root = new Branch();
+        new_root->children[0] = root_;
+        root_ = new_root;
+        shift_ += kBits;
+      }
+      push_tail(root_, shift_);
+    } catch (...) {
+      release(fresh, 0);
+      throw;
+    }
+    tail_ = fresh;
+    ++size_;
+  }
+
+  // Подвешивает заполненный хвост к дереву; ссылка хвоста переходит дереву
+  void push_tail(NodeBase *&slot, unsigned level) {
+    Branch *branch = unique_branch(slot, level);
+    NodeBase *&child = branch->children[((size_ - 1) >> level) & kMask];
+    if (level == kBits) {
+      child = tail_;
+    } else {
+      push_tail(child, level - kBits);
+    }
+  }
+
+  void set_in_place(size_t index, const T &value) {
+    if (index >= size_) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    if (index >= tail_offset()) {
+      unique_leaf(tail_)->values[index & kMask] = value;
+      return;
+    }
+    NodeBase **slot = &root_;
+    for (unsigned level = shift_; level > 0; level -= kBits) {
+      slot = &unique_branch(*slot, level)->children[(index >> level) & kMask];
+    }
+    unique_leaf(*slot)->values[index & kMask] = value;
+  }
+
+  void pop_back_in_place() {
+    if (size_ == 0) {
+      return;
+    }
+    if (size_ - tail_offset() > 1) {
+      unique_leaf(tail_)->values.pop_back();
+      --size_;
+      return;
+    }
+    if (size_ == 1) {
+      release(std::exchange(tail_, nullptr), 0);
+      size_ = 0;
+      return;
+    }
+    // Хвост опустел: новым хвостом становится последний лист дерева
+    NodeBase *new_tail = retain(const_cast<Leaf *>(leaf_for(size_ - 2)));
+    try {
+      if (pop_tail(root_, shift_)) {
+        release(std::exchange(root_, nullptr), shift_);
+        shift_ = kBits;
+      } else if (shift_ > kBits &&
+                 !static_cast<Branch *>(root_)->children[1]) {
+        NodeBase *old_root = root_;
+        root_ = retain(static_cast<Branch *>(old_root)->children[0]);
+        release(old_root, shift_);
+        shift_ -= kBits;
+      }
+    } catch (...) {
+      release(new_tail, 0);
+      throw;
+    }
+    release(std::exchange(tail_, new_tail), 0);
+    --size_;
+  }
+
+  // Снимает последний лист с дерева. Возвращает true, если узел опустел
+  bool pop_tail(NodeBase *&slot, unsigned level) {
+    Branch *branch = unique_branch(slot, level);
+    const size_t index = ((size_ - 2) >> level) & kMask;
+    NodeBase *&child = branch->children[index];
+    if (level == kBits || pop_tail(child, level - kBits)) {
+      release(std::exchange(child, nullptr), level - kBits);
+    } else {
+      return false;
+    }
+    return index == 0;
+  }
+};
+
+template <typename T>
+bool operator==(const PersistentVector<T> &lhs,
+                const PersistentVector<T> &rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T>
+bool operator!=(const PersistentVector<T> &lhs,
+                const PersistentVector<T> &rhs) {
+  return !(lhs == rhs);
+}
+
+} // end namespace persistent_vector
@@ -0,0 +1,238 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "parallel.hpp"
+#include "vector.hpp"
+
+namespace radix_sort {
+
+namespace detail {
+
+// 11-битные разряды: три прохода для 32-битных ключей и шесть для 64-битных,
+// таблица счётчиков одного разряда ещё помещается в L1
+constexpr unsigned kDigitBits = 11;
+constexpr size_t kBuckets = size_t{1} << kDigitBits;
+// Короче этого диапазона сортировка сравнением быстрее подсчёта
+constexpr size_t kSmallSize = 64;
+// Минимальная порция элементов на поток в параллельной версии
+constexpr size_t kMinChunk = 1 << 16;
+
+// Отображение ключа в беззнаковое целое с тем же порядком: у знаковых
+// инвертируется знаковый бит, у чисел с плавающей точкой отрицательные
+// инвертируются целиком, а положительным добавляется знаковый бит
+template <typename K> auto to_radix(K key) noexcept {
+  static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, bool>,
+                "Radix key must be an integer or floating-point value");
+  if constexpr (std::is_floating_point_v<K>) {
+    static_assert(sizeof(K) == 4 || sizeof(K) == 8,
+                  "Only float and double keys are supported");
+    using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+    U bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    constexpr U sign = U{1} << (sizeof(U) * 8 - 1);
+    return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+  } else if constexpr (std::is_signed_v<K>) {
+    using U = std::make_unsigned_t<K>;
+    return static_cast<U>(static_cast<U>(key) ^ (U{1} << (sizeof(U) * 8 - 1)));
+  } else {
+    return key;
+  }
+}
+
+template <typename Radix> size_t digit(Radix radix, size_t pass) noexcept {
+  return static_cast<size_t>(radix >> (pass * kDigitBits)) & (kBuckets - 1);
+}
+
+template <typename T, typename KeyFn>
+using RadixOf = decltype(to_radix(std::declval<KeyFn &>()(std::declval<T &>())));
+
+// Последовательная версия: гистограммы всех разрядов строятся за один
+// проход, затем выполняется по одному распределению на разряд. Разряд, все
+// значения которого совпадают, пропускается
+template <typename T, typename KeyFn>
+void sort_serial(T *data, T *scratch, size_t size, KeyFn &key) {
+  using Radix = RadixOf<T, KeyFn>;
+  constexpr size_t passes = (sizeof(Radix) * 8 + kDigitBits - 1) / kDigitBits;
+  size_t counts[passes][kBuckets] = {};
+  for (size_t i = 0; i < size; ++i) {
+    const Radix radix = to_radix(key(data[i]));
+    for (size_t pass = 0; pass < passes; ++pass) {
+      ++counts[pass][digit(radix, pass)];
+    }
+  }
+
+  T *from = data;
+  T *to = scratch;
+  for (size_t pass = 0; pass < passes; ++pass) {
+    size_t *count = counts[pass];
+    if (count[digit(to_radix(key(from[0])), pass)] == size) {
+      continue;
+    }
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < kBuckets; ++bucket) {
+      offset += std::exchange(count[bucket], offset);
+    }
+    for (size_t i = 0; i < size; ++i) {
+      to[count[digit(to_radix(key(from[i])), pass)]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != data) {
+    std::memcpy(static_cast<void *>(data), from, size * sizeof(T));
+  }
+}
+
+// Параллельная версия: на каждом разряде потоки считают гистограммы своих
+// порций, смещения раскладываются по корзинам, а внутри корзины — по
+// порциям, после чего каждая порция распределяется независимо
+template <typename T, typename KeyFn>
+void sort_parallel(parallel::ThreadPool &pool, T *data, T *scratch,
+                   size_t size, KeyFn &key) {
+  using Radix = RadixOf<T, KeyFn>;
+  constexpr size_t passes = (sizeof(Radix) * 8 + kDigitBits - 1) / kDigitBits;
+  const size_t chunks = std::min(pool.size() * 4, size / kMinChunk + 1);
+  const size_t chunk_size = (size + chunks - 1) / chunks;
+  vector::Vector<size_t> counts(chunks * kBuckets);
+
+  T *from = data;
+  T *to = scratch;
+  for (size_t pass = 0; pass < passes; ++pass) {
+    parallel::for_range(
+        pool, 0, chunks,
+        [&](size_t begin, size_t end) {
+          for (size_t chunk = begin; chunk < end; ++chunk) {
+            size_t *count = counts.data() + chunk * kBuckets;
+            std::fill(count, count + kBuckets, 0);
+            const size_t last = std::min(size, (chunk + 1) * chunk_size);
+            for (size_t i = chunk * chunk_size; i < last; ++i) {
+              ++count[digit(to_radix(key(from[i])), pass)];
+            }
+          }
+        },
+        1);
+
+    const size_t first_bucket = digit(to_radix(key(from[0])), pass);
+    size_t same = 0;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      same += counts[chunk * kBuckets + first_bucket];
+    }
+    if (same == size) {
+      continue;
+    }
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < kBuckets; ++bucket) {
+      for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        offset += std::exchange(counts[chunk * kBuckets + bucket], offset);
+      }
+    }
+
+    parallel::for_range(
+        pool, 0, chunks,
+        [&](size_t begin, size_t end) {
+          for (size_t chunk = begin; chunk < end; ++chunk) {
+            size_t *count = counts.data() + chunk * kBuckets;
+            const size_t last = std::min(size, (chunk + 1) * chunk_size);
+            for (size_t i = chunk * chunk_size; i < last; ++i) {
+              to[count[digit(to_radix(key(from[i])), pass)]++] = from[i];
+            }
+          }
+        },
+        1);
+    std::swap(from, to);
+  }
+  if (from != data) {
+    parallel::for_range(pool, 0, size, [&](size_t begin, size_t end) {
+      std::memcpy(static_cast<void *>(data + begin), from + begin,
+                  (end - begin) * sizeof(T));
+    });
+  }
+}
+
+template <typename T, typename KeyFn>
+bool sort_small(T *first, T *last, KeyFn &key) {
+  if (static_cast<size_t>(last - first) > kSmallSize) {
+    return false;
+  }
+  std::stable_sort(first, last, [&key](const T &lhs, const T &rhs) {
+    return to_radix(key(lhs)) < to_radix(key(rhs));
+  });
+  return true;
+}
+
+struct Identity {
+  template <typename T> const T &operator()(const T &value) const noexcept {
+    return value;
+  }
+};
+
+} // namespace detail
+
+// Устойчивая поразрядная сортировка LSD по ключу key(element), который
+// должен быть целым или числом с плавающей точкой. Элементы копируются
+// побайтово, поэтому T обязан быть тривиально копируемым. Вспомогательный
+// буфер того же размера берётся из RawMemory
+template <typename T, typename KeyFn>
+void sort_by_key(T *first, T *last, KeyFn key) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Radix sort moves elements bytewise");
+  if (detail::sort_small(first, last, key)) {
+    return;
+  }
+  const size_t size = last - first;
+  vector::RawMemory<T> scratch(size);
+  detail::sort_serial(first, scratch.get_address(), size, key);
+}
+
+template <typename T> void sort(T *first, T *last) {
+  sort_by_key(first, last, detail::Identity{});
+}
+
+// Параллельный вариант: распределение по разрядам выполняется в пуле
+template <typename T, typename KeyFn>
+void sort_by_key(parallel::ThreadPool &pool, T *first, T *last, KeyFn key) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Radix sort moves elements bytewise");
+  if (detail::sort_small(first, last, key)) {
+    return;
+  }
+  const size_t size = last - first;
+  vector::RawMemory<T> scratch(size);
+  if (pool.size() == 1 || size < 2 * detail::kMinChunk) {
+    detail::sort_serial(first, scratch.get_address(), size, key);
+  } else {
+    detail::sort_parallel(pool, first, scratch.get_address(), size, key);
+  }
+}
+
+template <typename T>
+void sort(parallel::ThreadPool &pool, T *first, T *last) {
+  sort_by_key(pool, first, last, detail::Identity{});
+}
+
+template <typename T, size_t Alignment, typename KeyFn>
+void sort_by_key(vector::Vector<T, Alignment> &values, KeyFn key) {
+  sort_by_key(values.begin(), values.end(), std::move(key));
+}
+
+template <typename T, size_t Alignment>
+void sort(vector::Vector<T, Alignment> &values) {
+  sort(values.begin(), values.end());
+}
+
+template <typename T, size_t Alignment, typename KeyFn>
+void sort_by_key(parallel::ThreadPool &pool,
+                 vector::Vector<T, Alignment> &values, KeyFn key) {
+  sort_by_key(pool, values.begin(), values.end(), std::move(key));
+}
+
+template <typename T, size_t Alignment>
+void sort(parallel::ThreadPool &pool, vector::Vector<T, Alignment> &values) {
+  sort(pool, values.begin(), values.end());
+}
+
+} // end namespace radix_sort
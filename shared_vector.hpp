@@ -0,0 +1,317 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace shared_vector {
+
+// Число элементов в блоке: степень двойки, блок занимает около 4 КБ
+template <typename T>
+constexpr size_t default_chunk_size() {
+  size_t size = 16;
+  while (size * 2 * sizeof(T) <= 4096) {
+    size *= 2;
+  }
+  return size;
+}
+
+// Вектор с копированием при записи. Данные разбиты на блоки по ChunkSize
+// элементов; блоки и корень (таблица блоков) разделяются между копиями через
+// атомарные счётчики ссылок. Копия (снимок) стоит O(1), первая запись в
+// разделяемый блок копирует только этот блок и таблицу блоков.
+// Каждый поток работает со своей копией: чтение не берёт блокировок, а
+// изменение одной копии не видно остальным
+template <typename T, size_t ChunkSize = default_chunk_size<T>()>
+class SharedVector {
+  static_assert((ChunkSize & (ChunkSize - 1)) == 0,
+                "ChunkSize must be a power of two");
+
+  struct Chunk {
+    Chunk() { items.reserve(ChunkSize); }
+    Chunk(const Chunk &other) : Chunk() {
+      for (const T &item : other.items) {
+        items.push_back(item);
+      }
+    }
+
+    std::atomic<size_t> refs{1};
+    vector::Vector<T> items;
+  };
+
+  struct Root {
+    std::atomic<size_t> refs{1};
+    vector::Vector<Chunk *> chunks;
+    size_t size = 0;
+  };
+
+public:
+  using value_type = T;
+
+  // Итератор только для чтения, хранит индекс элемента
+  class const_iterator {
+    friend class SharedVector;
+
+    const_iterator(const SharedVector *owner, size_t index) noexcept
+        : owner_(owner), index_(index) {}
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+    pointer operator->() const noexcept { return &(*owner_)[index_]; }
+
+    const_iterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++index_;
+      return old_value;
+    }
+    const_iterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    const_iterator operator--(int) noexcept {
+      auto old_value(*this);
+      --index_;
+      return old_value;
+    }
+    const_iterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    const_iterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    const_iterator operator+(difference_type n) const noexcept {
+      return const_iterator(owner_, index_ + n);
+    }
+    friend const_iterator operator+(difference_type n,
+                                    const const_iterator &it) noexcept {
+      return it + n;
+    }
+    const_iterator operator-(difference_type n) const noexcept {
+      return const_iterator(owner_, index_ - n);
+    }
+    difference_type operator-(const const_iterator &rhs) const noexcept {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(rhs.index_);
+    }
+    reference operator[](difference_type n) const noexcept {
+      return (*owner_)[index_ + n];
+    }
+
+    bool operator==(const const_iterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const const_iterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+    bool operator<(const const_iterator &rhs) const noexcept {
+      return index_ < rhs.index_;
+    }
+    bool operator>(const const_iterator &rhs) const noexcept {
+      return index_ > rhs.index_;
+    }
+    bool operator<=(const const_iterator &rhs) const noexcept {
+      return index_ <= rhs.index_;
+    }
+    bool operator>=(const const_iterator &rhs) const noexcept {
+      return index_ >= rhs.index_;
+    }
+
+  private:
+    const SharedVector *owner_ = nullptr;
+    size_t index_ = 0;
+  };
+
+  SharedVector() : root_(new Root()) {}
+
+  SharedVector(std::initializer_list<T> values) : SharedVector() {
+    for (const T &value : values) {
+      push_back(value);
+    }
+  }
+
+  SharedVector(const SharedVector &other) noexcept : root_(other.root_) {
+    root_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  SharedVector(SharedVector &&other) noexcept : SharedVector(other) {}
+
+  SharedVector &operator=(const SharedVector &rhs) noexcept {
+    SharedVector copy(rhs);
+    swap(copy);
+    return *this;
+  }
+
+  SharedVector &operator=(SharedVector &&rhs) noexcept {
+    swap(rhs);
+    return *this;
+  }
+
+  ~SharedVector() { release(root_); }
+
+  // Снимок текущего содержимого за O(1)
+  SharedVector snapshot() const noexcept { return *this; }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept {
+    return const_iterator(this, root_->size);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  size_t size() const noexcept { return root_->size; }
+  bool empty() const noexcept { return root_->size == 0; }
+
+  const T &operator[](size_t index) const noexcept {
+    return root_->chunks[index / ChunkSize]->items[index % ChunkSize];
+  }
+
+  const T &at(size_t index) const {
+    if (index >= root_->size) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    return (*this)[index];
+  }
+
+  // Ссылка для изменения элемента: разделяемый блок предварительно
+  // копируется. Ссылка действительна до следующего снимка
+  T &mutable_ref(size_t index) {
+    if (index >= root_->size) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    return unique_chunk(index / ChunkSize).items[index % ChunkSize];
+  }
+
+  void set(size_t index, T value) { mutable_ref(index) = std::move(value); }
+
+  void push_back(const T &value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args> const T &emplace_back(Args &&...args) {
+    unique_root();
+    const size_t chunk = root_->size / ChunkSize;
+    const bool fresh = chunk == root_->chunks.size();
+    if (fresh) {
+      Chunk *created = new Chunk();
+      try {
+        root_->chunks.push_back(created);
+      } catch (...) {
+        delete created;
+        throw;
+      }
+    }
+    vector::Vector<T> &items = unique_chunk(chunk).items;
+    try {
+      items.emplace_back(std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) {
+        release(root_->chunks[chunk]);
+        root_->chunks.pop_back();
+      }
+      throw;
+    }
+    ++root_->size;
+    return items[items.size() - 1];
+  }
+
+  void pop_back() {
+    if (root_->size == 0) {
+      return;
+    }
+    const size_t chunk = (root_->size - 1) / ChunkSize;
+    unique_chunk(chunk).items.pop_back();
+    --root_->size;
+    if (root_->size % ChunkSize == 0) {
+      release(root_->chunks[chunk]);
+      root_->chunks.pop_back();
+    }
+  }
+
+  void clear() {
+    SharedVector empty;
+    swap(empty);
+  }
+
+  void swap(SharedVector &other) noexcept { std::swap(root_, other.root_); }
+
+  // Число копий, разделяющих корень; 1 — копия единственная
+  size_t use_count() const noexcept {
+    return root_->refs.load(std::memory_order_acquire);
+  }
+
+private:
+  Root *root_;
+
+  static void release(Chunk *chunk) noexcept {
+    if (chunk->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete chunk;
+    }
+  }
+
+  static void release(Root *root) noexcept {
+    if (root && root->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      for (Chunk *chunk : root->chunks) {
+        release(chunk);
+      }
+      delete root;
+    }
+  }
+
+  // Делает корень собственным: при разделении копирует таблицу блоков,
+  // увеличивая счётчики самих блоков
+  void unique_root() {
+    if (root_->refs.load(std::memory_order_acquire) == 1) {
+      return;
+    }
+    Root *copy = new Root();
+    try {
+      copy->chunks.reserve(root_->chunks.size());
+    } catch (...) {
+      delete copy;
+      throw;
+    }
+    for (Chunk *chunk : root_->chunks) {
+      chunk->refs.fetch_add(1, std::memory_order_relaxed);
+      copy->chunks.push_back(chunk);
+    }
+    copy->size = root_->size;
+    release(std::exchange(root_, copy));
+  }
+
+  Chunk &unique_chunk(size_t index) {
+    unique_root();
+    Chunk *&chunk = root_->chunks[index];
+    if (chunk->refs.load(std::memory_order_acquire) != 1) {
+      Chunk *copy = new Chunk(*chunk);
+      release(std::exchange(chunk, copy));
+    }
+    return *chunk;
+  }
+};
+
+template <typename T, size_t ChunkSize>
+bool operator==(const SharedVector<T, ChunkSize> &lhs,
+                const SharedVector<T, ChunkSize> &rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+} // end namespace shared_vector
@@ -1,21 +1,37 @@
+#pragma once
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
+#include "check.hpp"
+#include "telemetry.hpp"
+#include "vector.hpp"
+
 namespace single_linked_list {
 
 template <typename Type>
 class SingleLinkedList {
+  // Звено цепочки без значения. Из него состоит фиктивный узел перед
+  // первым элементом: он хранится прямо в объекте списка, поэтому пустой
+  // список ничего не выделяет
+  struct NodeBase {
+    NodeBase *next_node = nullptr;
+  };
+
   // Узел списка
-  struct Node {
-    Node() = default;
-    Node(const Type &val, Node *next) : value(val), next_node(next) {}
+  struct Node : NodeBase {
+    Node(const Type &val, NodeBase *next) : NodeBase{next}, value(val) {}
+    Node(Type &&val, NodeBase *next)
+        : NodeBase{next}, value(std::move(val)) {}
     Type value;
-    Node *next_node = nullptr;
   };
 
   // Шаблон класса «Базовый Итератор».
@@ -29,7 +45,7 @@ class SingleLinkedList {
     friend class SingleLinkedList;
 
     // Конвертирующий конструктор итератора из указателя на узел списка
-    explicit BasicIterator(Node *node) { node_ = node; }
+    explicit BasicIterator(NodeBase *node) { node_ = node; }
 
    public:
     // Объявленные ниже типы сообщают стандартной библиотеке о свойствах этого
@@ -115,21 +131,23 @@ class SingleLinkedList {
     // Операция разыменования. Возвращает ссылку на текущий элемент
     // Вызов этого оператора у итератора, не указывающего на существующий
     // элемент списка, приводит к неопределённому поведению
-    [[nodiscard]] reference operator*() const noexcept { return node_->value; }
+    [[nodiscard]] reference operator*() const noexcept {
+      return static_cast<Node *>(node_)->value;
+    }
 
     // Операция доступа к члену класса. Возвращает указатель на текущий элемент
     // списка Вызов этого оператора у итератора, не указывающего на существующий
     // элемент списка, приводит к неопределённому поведению
     [[nodiscard]] pointer operator->() const noexcept {
       if (node_) {
-        return &node_->value;
+        return &static_cast<Node *>(node_)->value;
       } else {
         return nullptr;
       }
     }
 
    private:
-    Node *node_ = nullptr;
+    NodeBase *node_ = nullptr;
   };
 
  public:
@@ -144,7 +162,7 @@ class SingleLinkedList {
 
   // Возвращает итератор, ссылающийся на первый элемент
   // Если список пустой, возвращённый итератор будет равен end()
-  [[nodiscard]] Iterator begin() noexcept { return Iterator(head_->next_node); }
+  [[nodiscard]] Iterator begin() noexcept { return Iterator(head_.next_node); }
 
   // Возвращает итератор, указывающий на позицию, следующую за последним
   // элементом односвязного списка Разыменовывать этот итератор нельзя — попытка
@@ -155,7 +173,7 @@ class SingleLinkedList {
   // Если список пустой, возвращённый итератор будет равен end()
   // Результат вызова эквивалентен вызову метода cbegin()
   [[nodiscard]] ConstIterator begin() const noexcept {
-    return ConstIterator(head_->next_node);
+    return ConstIterator(head_.next_node);
   }
 
   // Возвращает константный итератор, указывающий на позицию, следующую за
@@ -169,7 +187,7 @@ class SingleLinkedList {
   // Возвращает константный итератор, ссылающийся на первый элемент
   // Если список пустой, возвращённый итератор будет равен cend()
   [[nodiscard]] ConstIterator cbegin() const noexcept {
-    return ConstIterator(head_->next_node);
+    return ConstIterator(head_.next_node);
   }
 
   // Возвращает константный итератор, указывающий на позицию, следующую за
@@ -180,13 +198,19 @@ class SingleLinkedList {
   }
 
  public:
-  SingleLinkedList() {
-    head_ = new Node();
-    end_ = new Node();
-  };
+  SingleLinkedList() = default;
+
   // Возвращает количество элементов в списке за время O(1)
   [[nodiscard]] size_t size() const noexcept { return size_; }
 
+  // Возвращает число байт, занятых списком: сам объект (вместе с
+  // фиктивным узлом), отдельные узлы и общий блок узлов целиком, включая
+  // слоты уже удалённых из него элементов
+  [[nodiscard]] size_t memory_usage() const noexcept {
+    return sizeof(*this) +
+           (size_ - pooled_size_ + block_.capacity()) * sizeof(Node);
+  }
+
   SingleLinkedList(std::initializer_list<Type> values) {
     SingleLinkedList temp;
     temp.init(values.begin(), values.end());
@@ -194,35 +218,41 @@ class SingleLinkedList {
   }
 
   // Move ctor
-  SingleLinkedList(SingleLinkedList &&other) noexcept {
-    size_ = other.size_;
-    other.size_ = 0;
-    head_ = other.head_;
-    other.head_ = nullptr;
-    end_ = other.end_;
-    other.end_ = nullptr;
-  }
+  SingleLinkedList(SingleLinkedList &&other) noexcept { swap(other); }
 
   // Move assignment operator
   SingleLinkedList &operator=(SingleLinkedList &&rhs) noexcept {
-    this->size_ = rhs.size_;
-    rhs.size_ = 0;
-    this->head_ = rhs.head_;
-    rhs.head_ = nullptr;
-    this->end_ = rhs.end_;
-    rhs.end_ = nullptr;
-
+    swap(rhs);
     return *this;
   }
 
+  // Заполняет пустой список элементами диапазона. Для прямых итераторов
+  // длина известна заранее, и все узлы берутся из одного блока: одно
+  // выделение памяти вместо N, узлы лежат в памяти подряд
   template <typename TypeIt>
   void init(TypeIt begin, TypeIt end) {
-    Node *node = head_;
-    for (TypeIt i = begin; i != end; ++i) {
-      ++size_;
-      node->next_node = new Node(*i, nullptr);
-      node = node->next_node;
+    assert(size_ == 0 && block_.capacity() == 0);
+    NodeBase *node = &head_;
+    using Category = typename std::iterator_traits<TypeIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      const auto count = static_cast<size_t>(std::distance(begin, end));
+      if (count != 0) {
+        block_ = vector::RawMemory<Node>(count);
+      }
+      for (Node *slot = block_.get_address(); begin != end; ++begin, ++slot) {
+        node->next_node = new (slot) Node(*begin, nullptr);
+        node = slot;
+        ++size_;
+        ++pooled_size_;
+      }
+    } else {
+      for (; begin != end; ++begin) {
+        node->next_node = new Node(*begin, nullptr);
+        node = node->next_node;
+        ++size_;
+      }
     }
+    end_ = node;
   }
 
   SingleLinkedList(const SingleLinkedList &other) {
@@ -239,25 +269,32 @@ class SingleLinkedList {
     return *this;
   }
 
-  Type &operator[](const size_t index) {
-    if (index >= size_) {
-      throw std::out_of_range("Index");
-    } else {
-      Node *p = head_->next_node;
-      for (size_t i = 0; i != index; ++i) {
-        p = p->next_node;
-      }
-      return p->value;
-    }
+  // Проверка индекса зависит от CONTAINERS_CHECK_LEVEL (check.hpp)
+  Type &operator[](const size_t index) noexcept(check::kNothrow) {
+    check::require(index < size_, "Index");
+    return node_at(index)->value;
+  }
+
+  // Индекс проверяется всегда, при выходе за размер — std::out_of_range
+  Type &at(const size_t index) {
+    check::always(index < size_, "Index");
+    return node_at(index)->value;
   }
 
   // Обменивает содержимое списков за время O(1)
+  // Фиктивные узлы остаются на месте, обмениваются цепочки за ними
   void swap(SingleLinkedList &other) noexcept {
-    std::swap(head_, other.head_);
-    other.head_ = nullptr;
+    std::swap(head_.next_node, other.head_.next_node);
     std::swap(end_, other.end_);
-    other.end_ = nullptr;
     std::swap(size_, other.size_);
+    block_.swap(other.block_);
+    std::swap(pooled_size_, other.pooled_size_);
+    if (size_ == 0) {
+      end_ = &head_;
+    }
+    if (other.size_ == 0) {
+      other.end_ = &other.head_;
+    }
   }
 
   // Сообщает, пустой ли список за время O(1)
@@ -270,14 +307,18 @@ class SingleLinkedList {
 
   // Вставляет элемент value в начало списка за время O(1)
   void push_front(const Type &value) {
-    head_->next_node = new Node(value, head_->next_node);
+    telemetry::Scope scope(telemetry::Container::SingleLinkedList,
+                           telemetry::Operation::Push);
+    head_.next_node = new Node(value, head_.next_node);
     if (size_ == 0) {
-      end_ = head_->next_node;
+      end_ = head_.next_node;
     }
     ++size_;
   }
 
   void push_back(const Type &value) {
+    telemetry::Scope scope(telemetry::Container::SingleLinkedList,
+                           telemetry::Operation::Push);
     if (size_ == 0) {
       push_front(value);
     } else {
@@ -289,6 +330,58 @@ class SingleLinkedList {
     }
   }
 
+  // Обходит элементы, заранее запрашивая следующий узел в кэш, пока f
+  // обрабатывает текущий. Если следующий узел лежит в памяти сразу за
+  // текущим, подсказка не нужна: такой поток отслеживает аппаратная
+  // предвыборка
+  template <typename F>
+  void for_each(F f) {
+    for (Node *node = static_cast<Node *>(head_.next_node); node;) {
+      Node *next = static_cast<Node *>(node->next_node);
+      if (next != node + 1) {
+        prefetch(next);
+      }
+      f(node->value);
+      node = next;
+    }
+  }
+
+  template <typename T, typename Reduce, typename Transform>
+  T transform_reduce(T init, Reduce reduce, Transform transform) {
+    for_each([&](Type &value) {
+      init = reduce(std::move(init), transform(value));
+    });
+    return init;
+  }
+
+  // Обходит несколько независимых списков по очереди, по одному элементу из
+  // каждого: промахи кэша в разных цепочках обслуживаются параллельно,
+  // тогда как внутри одной цепочки адрес следующего узла известен только
+  // после загрузки текущего. f вызывается как f(номер списка, элемент)
+  template <typename F, typename... Lists>
+  static void for_each_interleaved(F f, Lists &...lists) {
+    static_assert((std::is_same_v<Lists, SingleLinkedList> && ...),
+                  "All lists must have the same type");
+    Node *cursors[] = {static_cast<Node *>(lists.head_.next_node)...};
+    size_t active = 0;
+    for (Node *cursor : cursors) {
+      active += cursor != nullptr;
+    }
+    while (active) {
+      for (size_t i = 0; i < sizeof...(Lists); ++i) {
+        Node *&cursor = cursors[i];
+        if (!cursor) {
+          continue;
+        }
+        Node *next = static_cast<Node *>(cursor->next_node);
+        prefetch(next);
+        f(i, cursor->value);
+        cursor = next;
+        active -= cursor == nullptr;
+      }
+    }
+  }
+
   void print() {
     if (is_empty()){
       std::cout << "Single linked list is empty" << std::endl;
@@ -300,29 +393,34 @@ class SingleLinkedList {
     std::cout << std::endl;
   }
 
-  // Очищает список за время O(N)
+  // Очищает список за время O(N). Если все узлы лежат в общем блоке, а
+  // у Type тривиальный деструктор, цепочка не обходится вовсе: блок
+  // освобождается одним вызовом
   void clear() noexcept {
-    if (head_){
-      while (head_->next_node) {
-        delete std::exchange(head_->next_node, head_->next_node->next_node);
+    telemetry::Scope scope(telemetry::Container::SingleLinkedList,
+                           telemetry::Operation::Clear);
+    if (!std::is_trivially_destructible_v<Type> || pooled_size_ != size_) {
+      while (head_.next_node) {
+        destroy_node(std::exchange(head_.next_node, head_.next_node->next_node));
       }
+    }
+    head_.next_node = nullptr;
+    end_ = &head_;
     size_ = 0;
+    pooled_size_ = 0;
+    block_ = vector::RawMemory<Node>();
   }
-}
 
-// Возвращает итератор, указывающий на позицию перед первым элементом
-// односвязного списка. Разыменовывать этот итератор нельзя - попытка
-// разыменования приведёт к неопределённому поведению
-[[nodiscard]] Iterator
-before_begin() noexcept {
-  return Iterator(head_);
-}
+  // Возвращает итератор, указывающий на позицию перед первым элементом
+  // односвязного списка. Разыменовывать этот итератор нельзя - попытка
+  // разыменования приведёт к неопределённому поведению
+  [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
 
   // Возвращает константный итератор, указывающий на позицию перед первым
   // элементом односвязного списка. Разыменовывать этот итератор нельзя -
   // попытка разыменования приведёт к неопределённому поведению
   [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-    return ConstIterator{const_cast<Node *>(&head_)};
+    return ConstIterator{const_cast<NodeBase *>(&head_)};
   }
 
   // Возвращает константный итератор, указывающий на позицию перед первым
@@ -339,9 +437,14 @@ before_begin() noexcept {
    * прежнем состоянии
    */
   Iterator insert(ConstIterator pos, const Type &value) {
+    telemetry::Scope scope(telemetry::Container::SingleLinkedList,
+                           telemetry::Operation::Insert);
     if (pos.node_) {
       auto &new_node = pos.node_;
       new_node->next_node = new Node(value, new_node->next_node);
+      if (!new_node->next_node->next_node) {
+        end_ = new_node->next_node;
+      }
       ++size_;
       return Iterator{new_node->next_node};
     } else {
@@ -350,8 +453,10 @@ before_begin() noexcept {
   }
 
   void pop_front() noexcept {
+    telemetry::Scope scope(telemetry::Container::SingleLinkedList,
+                           telemetry::Operation::Erase);
     if (size_ != 0) {
-      delete std::exchange(head_->next_node, head_->next_node->next_node);
+      destroy_node(std::exchange(head_.next_node, head_.next_node->next_node));
       --size_;
     }
   }
@@ -361,10 +466,15 @@ before_begin() noexcept {
    * Возвращает итератор на элемент, следующий за удалённым
    */
   Iterator erase(ConstIterator pos) noexcept {
+    telemetry::Scope scope(telemetry::Container::SingleLinkedList,
+                           telemetry::Operation::Erase);
     if (pos.node_ && pos.node_->next_node) {
       --size_;
-      delete std::exchange(pos.node_->next_node,
-                           pos.node_->next_node->next_node);
+      if (pos.node_->next_node == end_) {
+        end_ = pos.node_;
+      }
+      destroy_node(std::exchange(pos.node_->next_node,
+                                 pos.node_->next_node->next_node));
       return Iterator{pos.node_->next_node};
     } else {
       return Iterator(nullptr);
@@ -374,12 +484,49 @@ before_begin() noexcept {
   ~SingleLinkedList() { clear(); }
 
  private:
+  static void prefetch(const void *address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+  }
+
+  Node *node_at(size_t index) const noexcept {
+    NodeBase *p = head_.next_node;
+    for (size_t i = 0; i != index; ++i) {
+      p = p->next_node;
+    }
+    return static_cast<Node *>(p);
+  }
+
+  // Узел из общего блока только разрушается; блок освобождается целиком,
+  // когда в нём не остаётся живых узлов
+  void destroy_node(NodeBase *base) noexcept {
+    Node *node = static_cast<Node *>(base);
+    const Node *first = block_.get_address();
+    if (std::less_equal<const Node *>()(first, node) &&
+        std::less<const Node *>()(node, first + block_.capacity())) {
+      std::destroy_at(node);
+      if (--pooled_size_ == 0) {
+        block_ = vector::RawMemory<Node>();
+      }
+    } else {
+      delete node;
+    }
+  }
+
   // Фиктивный узел, используется для вставки "перед первым элементом"
-  Node *head_;
+  NodeBase head_;
 
-  Node *end_;
+  // Последний узел; у пустого списка — фиктивный
+  NodeBase *end_ = &head_;
 
   size_t size_ = 0;
+
+  // Блок узлов, созданный init(), и число живых узлов в нём
+  vector::RawMemory<Node> block_;
+  size_t pooled_size_ = 0;
 };
 
 template <typename Type>
@@ -0,0 +1,317 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace soa_vector {
+
+// Непрерывный участок одной колонки (аналог std::span для C++17)
+template <typename T> class Column {
+public:
+  using value_type = std::remove_const_t<T>;
+  using iterator = T *;
+
+  Column(T *data, size_t size) noexcept : data_(data), size_(size) {}
+
+  iterator begin() const noexcept { return data_; }
+  iterator end() const noexcept { return data_ + size_; }
+  T *data() const noexcept { return data_; }
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  T &operator[](size_t index) const noexcept { return data_[index]; }
+
+private:
+  T *data_ = nullptr;
+  size_t size_ = 0;
+};
+
+// Контейнер «структура массивов»: каждое поле хранится в своём RawMemory,
+// поэтому проход по одной колонке читает память подряд
+template <typename... Fields> class SoaVector {
+  static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field");
+
+  using Indices = std::index_sequence_for<Fields...>;
+
+  template <size_t I>
+  using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+  // Прокси строки: ссылается на контейнер и индекс, поля читаются через get<I>
+  template <bool IsConst> class BasicRow {
+    friend class SoaVector;
+    using Owner = std::conditional_t<IsConst, const SoaVector, SoaVector>;
+
+    BasicRow(Owner *owner, size_t index) noexcept
+        : owner_(owner), index_(index) {}
+
+  public:
+    template <size_t I> auto &get() const noexcept {
+      return owner_->template column<I>()[index_];
+    }
+
+    std::tuple<Fields...> value() const {
+      return value(Indices{});
+    }
+
+    const BasicRow &operator=(const std::tuple<Fields...> &values) const {
+      static_assert(!IsConst, "cannot assign through ConstRow");
+      assign(values, Indices{});
+      return *this;
+    }
+
+    size_t index() const noexcept { return index_; }
+
+  private:
+    Owner *owner_;
+    size_t index_;
+
+    template <size_t... I>
+    std::tuple<Fields...> value(std::index_sequence<I...>) const {
+      return std::tuple<Fields...>(get<I>()...);
+    }
+
+    template <size_t... I>
+    void assign(const std::tuple<Fields...> &values,
+                std::index_sequence<I...>) const {
+      ((get<I>() = std::get<I>(values)), ...);
+    }
+  };
+
+public:
+  using Row = BasicRow<false>;
+  using ConstRow = BasicRow<true>;
+
+  SoaVector() = default;
+
+  SoaVector(const SoaVector &other) : columns_(allocate(other.size_)) {
+    copy_from(other, Indices{});
+    size_ = other.size_;
+  }
+
+  SoaVector(SoaVector &&other) noexcept
+      : columns_(std::move(other.columns_)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  SoaVector &operator=(const SoaVector &other) {
+    if (this != &other) {
+      SoaVector copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  SoaVector &operator=(SoaVector &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~SoaVector() { destroy(0, size_, Indices{}); }
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  size_t capacity() const noexcept {
+    return std::get<0>(columns_).capacity();
+  }
+
+  void swap(SoaVector &other) noexcept {
+    swap_columns(columns_, other.columns_, Indices{});
+    std::swap(size_, other.size_);
+  }
+
+  // Колонка I как непрерывный участок длины size()
+  template <size_t I> Column<FieldType<I>> column() noexcept {
+    return {std::get<I>(columns_).get_address(), size_};
+  }
+  template <size_t I> Column<const FieldType<I>> column() const noexcept {
+    return {std::get<I>(columns_).get_address(), size_};
+  }
+
+  Row operator[](size_t index) noexcept { return Row(this, index); }
+  ConstRow operator[](size_t index) const noexcept {
+    return ConstRow(this, index);
+  }
+
+  void reserve(size_t new_capacity) {
+    if (new_capacity <= capacity()) {
+      return;
+    }
+    Columns new_columns = allocate(new_capacity);
+    relocate(new_columns, Indices{});
+    swap_columns(columns_, new_columns, Indices{});
+  }
+
+  void push_back(const Fields &...values) { emplace_back(values...); }
+
+  // Каждый аргумент конструирует соответствующее поле новой строки
+  template <typename... Args> Row emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "emplace_back takes exactly one argument per field");
+    if (capacity() <= size_) {
+      Columns new_columns = allocate(size_ == 0 ? 1 : size_ * 2);
+      construct_row(new_columns, size_, Indices{},
+                    std::forward<Args>(args)...);
+      try {
+        relocate(new_columns, Indices{});
+      } catch (...) {
+        destroy_first(new_columns, sizeof...(Fields), size_, size_ + 1,
+                      Indices{});
+        throw;
+      }
+      swap_columns(columns_, new_columns, Indices{});
+    } else {
+      construct_row(columns_, size_, Indices{}, std::forward<Args>(args)...);
+    }
+    return Row(this, size_++);
+  }
+
+  void pop_back() {
+    if (size_) {
+      destroy(size_ - 1, size_, Indices{});
+      --size_;
+    }
+  }
+
+  // Удаляет строку index, сдвигая хвост каждой колонки
+  void erase(size_t index) {
+    if (index >= size_) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    erase_row(index, Indices{});
+    destroy(size_ - 1, size_, Indices{});
+    --size_;
+  }
+
+  void clear() noexcept {
+    destroy(0, size_, Indices{});
+    size_ = 0;
+  }
+
+private:
+  using Columns = std::tuple<vector::RawMemory<Fields>...>;
+
+  Columns columns_;
+  size_t size_ = 0;
+
+  static Columns allocate(size_t capacity) {
+    return Columns(vector::RawMemory<Fields>(capacity)...);
+  }
+
+  template <size_t... I>
+  void destroy(size_t from, size_t to, std::index_sequence<I...>) noexcept {
+    (std::destroy(std::get<I>(columns_).get_address() + from,
+                  std::get<I>(columns_).get_address() + to),
+     ...);
+  }
+
+  template <size_t... I>
+  void copy_from(const SoaVector &other, std::index_sequence<I...> seq) {
+    size_t copied = 0;
+    try {
+      ((std::uninitialized_copy_n(std::get<I>(other.columns_).get_address(),
+                                  other.size_,
+                                  std::get<I>(columns_).get_address()),
+        ++copied),
+       ...);
+    } catch (...) {
+      destroy_first(columns_, copied, 0, other.size_, seq);
+      throw;
+    }
+  }
+
+  // Разрушает элементы [from, to) в первых count колонках
+  template <size_t... I>
+  static void destroy_first(Columns &columns, size_t count, size_t from,
+                            size_t to, std::index_sequence<I...>) noexcept {
+    ((I < count ? std::destroy(std::get<I>(columns).get_address() + from,
+                               std::get<I>(columns).get_address() + to)
+                : void()),
+     ...);
+  }
+
+  // Конструирует строку в позиции index; при исключении откатывает уже
+  // созданные поля
+  template <size_t... I, typename... Args>
+  static void construct_row(Columns &columns, size_t index,
+                            std::index_sequence<I...> seq, Args &&...args) {
+    size_t constructed = 0;
+    try {
+      ((new (std::get<I>(columns).get_address() + index)
+            FieldType<I>(std::forward<Args>(args)),
+        ++constructed),
+       ...);
+    } catch (...) {
+      destroy_first(columns, constructed, index, index + 1, seq);
+      throw;
+    }
+  }
+
+  // Перемещение или копирование выбирается для строки целиком: строки
+  // перемещаются, только если перемещение не бросает ни в одной колонке.
+  // Иначе перемещённую колонку не вернуть, когда бросит копирование
+  // следующей. Колонки без копирования перемещаются в любом случае
+  static constexpr bool kMoveRows =
+      (std::is_nothrow_move_constructible_v<Fields> && ...);
+
+  template <size_t I> static constexpr bool moves_column() noexcept {
+    return kMoveRows || !std::is_copy_constructible_v<FieldType<I>>;
+  }
+
+  // Переносит все колонки в new_columns; старые элементы разрушаются только
+  // после того, как перенос всех колонок завершился успешно. Перемещаемые
+  // колонки переносятся после копируемых, поэтому при исключении старые
+  // строки остаются целыми, если только не бросает перемещение колонки без
+  // копирования (тогда гарантия лишь базовая)
+  template <size_t... I>
+  void relocate(Columns &new_columns, std::index_sequence<I...> seq) {
+    bool relocated[sizeof...(I)] = {};
+    try {
+      ((moves_column<I>() ? void()
+                          : (relocate_column<I>(new_columns),
+                             void(relocated[I] = true))),
+       ...);
+      ((moves_column<I>() ? (relocate_column<I>(new_columns),
+                             void(relocated[I] = true))
+                          : void()),
+       ...);
+    } catch (...) {
+      ((relocated[I] ? std::destroy(std::get<I>(new_columns).get_address(),
+                                    std::get<I>(new_columns).get_address() +
+                                        size_)
+                     : void()),
+       ...);
+      throw;
+    }
+    destroy(0, size_, seq);
+  }
+
+  template <size_t I> void relocate_column(Columns &new_columns) {
+    using T = FieldType<I>;
+    T *from = std::get<I>(columns_).get_address();
+    T *to = std::get<I>(new_columns).get_address();
+    if constexpr (moves_column<I>()) {
+      std::uninitialized_move_n(from, size_, to);
+    } else {
+      std::uninitialized_copy_n(from, size_, to);
+    }
+  }
+
+  template <size_t... I>
+  static void swap_columns(Columns &lhs, Columns &rhs,
+                           std::index_sequence<I...>) noexcept {
+    (std::get<I>(lhs).swap(std::get<I>(rhs)), ...);
+  }
+
+  template <size_t... I>
+  void erase_row(size_t index, std::index_sequence<I...>) {
+    (std::move(std::get<I>(columns_).get_address() + index + 1,
+               std::get<I>(columns_).get_address() + size_,
+               std::get<I>(columns_).get_address() + index),
+     ...);
+  }
+};
+
+} // end namespace soa_vector
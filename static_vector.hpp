@@ -0,0 +1,280 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace static_vector {
+
+// Политики переполнения. overflow() вызывается при попытке добавить элемент
+// в заполненный контейнер; если функция вернула управление, операция
+// сообщает о неудаче через возвращаемое значение
+struct ThrowOnOverflow {
+  static bool overflow() {
+    throw std::length_error("StaticVector capacity exceeded");
+  }
+};
+
+struct AbortOnOverflow {
+  static bool overflow() noexcept { std::abort(); }
+};
+
+struct CheckedOverflow {
+  static constexpr bool overflow() noexcept { return false; }
+};
+
+namespace detail {
+
+// Хранилище для тривиальных типов: обычный массив, все операции constexpr,
+// деструктор тривиальный — контейнер остаётся литеральным типом
+template <typename T, size_t N, bool = std::is_trivial_v<T>>
+class Storage {
+protected:
+  constexpr T *ptr() noexcept { return data_; }
+  constexpr const T *ptr() const noexcept { return data_; }
+
+  template <typename... Args>
+  constexpr void construct(size_t index, Args &&...args) {
+    data_[index] = T(std::forward<Args>(args)...);
+  }
+  constexpr void destroy(size_t) noexcept {}
+
+  T data_[N == 0 ? 1 : N]{};
+  size_t size_ = 0;
+};
+
+// Хранилище для остальных типов: выровненный сырой буфер внутри объекта
+template <typename T, size_t N> class Storage<T, N, false> {
+protected:
+  Storage() = default;
+
+  Storage(const Storage &other) {
+    std::uninitialized_copy_n(other.ptr(), other.size_, ptr());
+    size_ = other.size_;
+  }
+
+  Storage(Storage &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    std::uninitialized_move_n(other.ptr(), other.size_, ptr());
+    size_ = other.size_;
+  }
+
+  Storage &operator=(const Storage &rhs) {
+    if (this != &rhs) {
+      assign(rhs.ptr(), rhs.size_);
+    }
+    return *this;
+  }
+
+  Storage &operator=(Storage &&rhs) noexcept(
+      std::is_nothrow_move_assignable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &rhs) {
+      const size_t common = std::min(size_, rhs.size_);
+      std::move(rhs.ptr(), rhs.ptr() + common, ptr());
+      if (rhs.size_ > size_) {
+        std::uninitialized_move_n(rhs.ptr() + size_, rhs.size_ - size_,
+                                  ptr() + size_);
+      } else {
+        std::destroy_n(ptr() + rhs.size_, size_ - rhs.size_);
+      }
+      size_ = rhs.size_;
+    }
+    return *this;
+  }
+
+  ~Storage() { std::destroy_n(ptr(), size_); }
+
+  T *ptr() noexcept { return std::launder(reinterpret_cast<T *>(storage_)); }
+  const T *ptr() const noexcept {
+    return std::launder(reinterpret_cast<const T *>(storage_));
+  }
+
+  template <typename... Args> void construct(size_t index, Args &&...args) {
+    new (ptr() + index) T(std::forward<Args>(args)...);
+  }
+  void destroy(size_t index) noexcept { std::destroy_at(ptr() + index); }
+
+  alignas(T) unsigned char storage_[(N == 0 ? 1 : N) * sizeof(T)];
+  size_t size_ = 0;
+
+private:
+  void assign(const T *values, size_t count) {
+    const size_t common = std::min(size_, count);
+    std::copy_n(values, common, ptr());
+    if (count > size_) {
+      std::uninitialized_copy_n(values + size_, count - size_, ptr() + size_);
+    } else {
+      std::destroy_n(ptr() + count, size_ - count);
+    }
+    size_ = count;
+  }
+};
+
+} // namespace detail
+
+// Вектор фиксированной ёмкости N, хранящий элементы внутри объекта и никогда
+// не обращающийся к куче. Для тривиальных T пригоден в constexpr-контексте
+template <typename T, size_t N, typename OverflowPolicy = ThrowOnOverflow>
+class StaticVector : private detail::Storage<T, N> {
+  using Base = detail::Storage<T, N>;
+  using Base::construct;
+  using Base::destroy;
+  using Base::ptr;
+  using Base::size_;
+
+public:
+  using value_type = T;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  constexpr StaticVector() = default;
+
+  constexpr StaticVector(std::initializer_list<T> values) {
+    for (const T &value : values) {
+      push_back(value);
+    }
+  }
+
+  constexpr iterator begin() noexcept { return ptr(); }
+  constexpr iterator end() noexcept { return ptr() + size_; }
+  constexpr const_iterator cbegin() const noexcept { return ptr(); }
+  constexpr const_iterator cend() const noexcept { return ptr() + size_; }
+  constexpr const_iterator begin() const noexcept { return cbegin(); }
+  constexpr const_iterator end() const noexcept { return cend(); }
+
+  constexpr T *data() noexcept { return ptr(); }
+  constexpr const T *data() const noexcept { return ptr(); }
+
+  constexpr size_t size() const noexcept { return size_; }
+  static constexpr size_t capacity() noexcept { return N; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr bool full() const noexcept { return size_ == N; }
+
+  constexpr T &operator[](size_t index) noexcept { return ptr()[index]; }
+  constexpr const T &operator[](size_t index) const noexcept {
+    return ptr()[index];
+  }
+
+  constexpr T &front() noexcept { return ptr()[0]; }
+  constexpr const T &front() const noexcept { return ptr()[0]; }
+  constexpr T &back() noexcept { return ptr()[size_ - 1]; }
+  constexpr const T &back() const noexcept { return ptr()[size_ - 1]; }
+
+  // Возвращает false, если элемент не поместился (только для CheckedOverflow)
+  constexpr bool push_back(const T &value) {
+    return emplace_back(value) != nullptr;
+  }
+  constexpr bool push_back(T &&value) {
+    return emplace_back(std::move(value)) != nullptr;
+  }
+
+  // Возвращает указатель на новый элемент или nullptr при переполнении
+  template <typename... Args> constexpr T *emplace_back(Args &&...args) {
+    if (full()) {
+      OverflowPolicy::overflow();
+      return nullptr;
+    }
+    construct(size_, std::forward<Args>(args)...);
+    return ptr() + size_++;
+  }
+
+  constexpr void pop_back() noexcept {
+    if (size_) {
+      destroy(--size_);
+    }
+  }
+
+  // Возвращает итератор на новый элемент или end() при переполнении
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args) {
+    const size_t position = pos - cbegin();
+    if (position > size_) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    if (full()) {
+      OverflowPolicy::overflow();
+      return end();
+    }
+    if (position == size_) {
+      construct(size_, std::forward<Args>(args)...);
+      ++size_;
+    } else {
+      T value(std::forward<Args>(args)...);
+      // Перенесённый в конец элемент сразу учитывается в size_, чтобы
+      // исключение при сдвиге не оставило его без деструктора
+      construct(size_, std::move(ptr()[size_ - 1]));
+      ++size_;
+      for (size_t i = size_ - 2; i > position; --i) {
+        ptr()[i] = std::move(ptr()[i - 1]);
+      }
+      ptr()[position] = std::move(value);
+    }
+    return begin() + position;
+  }
+
+  constexpr iterator insert(const_iterator pos, const T &item) {
+    return emplace(pos, item);
+  }
+  constexpr iterator insert(const_iterator pos, T &&item) {
+    return emplace(pos, std::move(item));
+  }
+
+  constexpr iterator erase(const_iterator pos) {
+    const size_t position = pos - cbegin();
+    if (position >= size_) {
+      throw std::out_of_range("Incorrect Index");
+    }
+    for (size_t i = position + 1; i < size_; ++i) {
+      ptr()[i - 1] = std::move(ptr()[i]);
+    }
+    destroy(--size_);
+    return begin() + position;
+  }
+
+  constexpr bool resize(size_t new_size) {
+    if (new_size > N) {
+      return OverflowPolicy::overflow();
+    }
+    while (size_ > new_size) {
+      destroy(--size_);
+    }
+    while (size_ < new_size) {
+      construct(size_);
+      ++size_;
+    }
+    return true;
+  }
+
+  constexpr void clear() noexcept {
+    while (size_) {
+      destroy(--size_);
+    }
+  }
+};
+
+template <typename T, size_t N, typename Policy>
+constexpr bool operator==(const StaticVector<T, N, Policy> &lhs,
+                          const StaticVector<T, N, Policy> &rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T, size_t N, typename Policy>
+constexpr bool operator!=(const StaticVector<T, N, Policy> &lhs,
+                          const StaticVector<T, N, Policy> &rhs) {
+  return !(lhs == rhs);
+}
+
+} // end namespace static_vector
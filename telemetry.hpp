@@ -0,0 +1,412 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Телеметрия операций контейнеров. Включается при сборке макросом
+// CONTAINERS_TELEMETRY=1 (опция CMake CONTAINERS_TELEMETRY), который должен
+// совпадать во всех единицах трансляции. Без него Scope и reallocation
+// пустые и исчезают при компиляции. Во включённой сборке события получает
+// обработчик, установленный set_hook; пока он не установлен, операция
+// стоит одной атомарной загрузки
+#ifndef CONTAINERS_TELEMETRY
+#define CONTAINERS_TELEMETRY 0
+#endif
+
+namespace telemetry {
+
+inline constexpr bool kEnabled = CONTAINERS_TELEMETRY != 0;
+
+enum class Container { Vector, SingleLinkedList, DoubleLinkedList, kCount };
+
+enum class Operation { Push, Insert, Erase, Grow, Clear, kCount };
+
+inline const char *name(Container container) noexcept {
+  switch (container) {
+  case Container::Vector:
+    return "vector";
+  case Container::SingleLinkedList:
+    return "single_linked_list";
+  case Container::DoubleLinkedList:
+    return "double_linked_list";
+  default:
+    return "unknown";
+  }
+}
+
+inline const char *name(Operation operation) noexcept {
+  switch (operation) {
+  case Operation::Push:
+    return "push";
+  case Operation::Insert:
+    return "insert";
+  case Operation::Erase:
+    return "erase";
+  case Operation::Grow:
+    return "grow";
+  case Operation::Clear:
+    return "clear";
+  default:
+    return "unknown";
+  }
+}
+
+// Перераспределение буфера. tag — метка места вызова, см. ScopedTag
+struct Reallocation {
+  Container container;
+  const char *tag;
+  size_t element_size;
+  size_t size_before;
+  size_t size_after;
+  size_t capacity_before;
+  size_t capacity_after;
+};
+
+// Получатель событий. Методы вызываются из потока, выполняющего операцию,
+// и не должны бросать
+class Hook {
+public:
+  virtual ~Hook() = default;
+  virtual void operation(Container container, Operation operation,
+                         std::uint64_t nanoseconds) noexcept = 0;
+  virtual void reallocation(const Reallocation &event) noexcept = 0;
+};
+
+namespace detail {
+
+inline std::atomic<Hook *> &hook_slot() noexcept {
+  static std::atomic<Hook *> hook{nullptr};
+  return hook;
+}
+
+inline const char *&current_tag() noexcept {
+  thread_local const char *tag = "untagged";
+  return tag;
+}
+
+} // namespace detail
+
+// Обработчик должен жить, пока установлен; nullptr отключает запись
+inline void set_hook(Hook *hook) noexcept {
+  detail::hook_slot().store(hook, std::memory_order_release);
+}
+
+inline Hook *hook() noexcept {
+  return detail::hook_slot().load(std::memory_order_acquire);
+}
+
+// Метка места вызова для событий перераспределения в текущем потоке, пока
+// объект жив. Строка должна жить дольше объекта, обычно это литерал
+class ScopedTag {
+public:
+  explicit ScopedTag(const char *tag) noexcept
+      : previous_(std::exchange(detail::current_tag(), tag)) {}
+  ScopedTag(const ScopedTag &) = delete;
+  ScopedTag &operator=(const ScopedTag &) = delete;
+  ~ScopedTag() { detail::current_tag() = previous_; }
+
+private:
+  const char *previous_;
+};
+
+#define CONTAINERS_TELEMETRY_STRINGIFY_(x) #x
+#define CONTAINERS_TELEMETRY_STRINGIFY(x) CONTAINERS_TELEMETRY_STRINGIFY_(x)
+// Метка вида "file.cpp:42" для текущей области видимости
+#define CONTAINERS_TELEMETRY_HERE                                              \
+  ::telemetry::ScopedTag containers_telemetry_tag_(                            \
+      __FILE__ ":" CONTAINERS_TELEMETRY_STRINGIFY(__LINE__))
+
+// Замер длительности операции от создания до разрушения
+template <bool Enabled = kEnabled> class BasicScope {
+public:
+  BasicScope(Container container, Operation operation) noexcept
+      : hook_(hook()), container_(container), operation_(operation) {
+    if (hook_) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+  BasicScope(const BasicScope &) = delete;
+  BasicScope &operator=(const BasicScope &) = delete;
+  ~BasicScope() {
+    if (hook_) {
+      const auto elapsed = std::chrono::steady_clock::now() - start_;
+      hook_->operation(
+          container_, operation_,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+              .count());
+    }
+  }
+
+private:
+  Hook *hook_;
+  Container container_;
+  Operation operation_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+template <> class BasicScope<false> {
+public:
+  BasicScope(Container, Operation) noexcept {}
+};
+
+using Scope = BasicScope<>;
+
+inline void reallocation(Container container, size_t element_size,
+                         size_t size_before, size_t size_after,
+                         size_t capacity_before,
+                         size_t capacity_after) noexcept {
+  if constexpr (kEnabled) {
+    if (Hook *h = hook()) {
+      h->reallocation({container, detail::current_tag(), element_size,
+                       size_before, size_after, capacity_before,
+                       capacity_after});
+    }
+  } else {
+    (void)container, (void)element_size, (void)size_before, (void)size_after,
+        (void)capacity_before, (void)capacity_after;
+  }
+}
+
+// Гистограмма длительностей: корзина k считает операции не длиннее 2^k нс
+class Histogram {
+public:
+  static constexpr size_t kBuckets = 32;
+
+  void add(std::uint64_t nanoseconds) noexcept {
+    size_t bucket = 0;
+    while (bucket + 1 < kBuckets &&
+           (std::uint64_t{1} << bucket) < nanoseconds) {
+      ++bucket;
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(nanoseconds, std::memory_order_relaxed);
+  }
+
+  std::uint64_t count() const noexcept {
+    return count_.load(std::memory_order_relaxed);
+  }
+  std::uint64_t sum() const noexcept {
+    return sum_.load(std::memory_order_relaxed);
+  }
+  std::uint64_t bucket(size_t index) const noexcept {
+    return buckets_[index].load(std::memory_order_relaxed);
+  }
+  static std::uint64_t upper_bound(size_t index) noexcept {
+    return std::uint64_t{1} << index;
+  }
+
+private:
+  std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+  std::atomic<std::uint64_t> count_{0};
+  std::atomic<std::uint64_t> sum_{0};
+};
+
+// Обработчик по умолчанию: гистограммы по контейнеру и операции, сводка
+// перераспределений по меткам и последние kRecent перераспределений с
+// размерами до и после. Выгружается в текстовом формате Prometheus и в JSON
+class Recorder : public Hook {
+public:
+  static constexpr size_t kRecent = 256;
+
+  struct TagTotals {
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+    size_t max_capacity = 0;
+  };
+
+  void operation(Container container, Operation operation,
+                 std::uint64_t nanoseconds) noexcept override {
+    histograms_[static_cast<size_t>(container)][static_cast<size_t>(operation)]
+        .add(nanoseconds);
+  }
+
+  void reallocation(const Reallocation &event) noexcept override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    recent_[recorded_++ % kRecent] = event;
+    try {
+      TagTotals &totals =
+          reallocations_[{static_cast<size_t>(event.container), event.tag}];
+      ++totals.count;
+      totals.bytes += event.capacity_after * event.element_size;
+      if (event.capacity_after > totals.max_capacity) {
+        totals.max_capacity = event.capacity_after;
+      }
+    } catch (...) {
+      ++dropped_;
+    }
+  }
+
+  const Histogram &histogram(Container container,
+                             Operation operation) const noexcept {
+    return histograms_[static_cast<size_t>(container)]
+                      [static_cast<size_t>(operation)];
+  }
+
+  TagTotals reallocations(Container container, const std::string &tag) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = reallocations_.find({static_cast<size_t>(container), tag});
+    return it == reallocations_.end() ? TagTotals{} : it->second;
+  }
+
+  std::string prometheus() const {
+    std::string out;
+    out += "# HELP containers_operation_duration_seconds Container operation "
+           "latency\n"
+           "# TYPE containers_operation_duration_seconds histogram\n";
+    for_each_histogram([&](const std::string &labels, const Histogram &h) {
+      std::uint64_t cumulative = 0;
+      for (size_t i = 0; i < Histogram::kBuckets; ++i) {
+        cumulative += h.bucket(i);
+        out += "containers_operation_duration_seconds_bucket{" + labels +
+               ",le=\"" + seconds(Histogram::upper_bound(i)) + "\"} " +
+               std::to_string(cumulative) + "\n";
+      }
+      out += "containers_operation_duration_seconds_bucket{" + labels +
+             ",le=\"+Inf\"} " + std::to_string(h.count()) + "\n";
+      out += "containers_operation_duration_seconds_sum{" + labels + "} " +
+             seconds(h.sum()) + "\n";
+      out += "containers_operation_duration_seconds_count{" + labels + "} " +
+             std::to_string(h.count()) + "\n";
+    });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    out += "# HELP containers_reallocations_total Buffer reallocations by "
+           "call-site tag\n"
+           "# TYPE containers_reallocations_total counter\n";
+    for (const auto &[key, totals] : reallocations_) {
+      out += "containers_reallocations_total" + tag_labels(key) + " " +
+             std::to_string(totals.count) + "\n";
+    }
+    out += "# HELP containers_reallocated_bytes_total Bytes allocated by "
+           "reallocations\n"
+           "# TYPE containers_reallocated_bytes_total counter\n";
+    for (const auto &[key, totals] : reallocations_) {
+      out += "containers_reallocated_bytes_total" + tag_labels(key) + " " +
+             std::to_string(totals.bytes) + "\n";
+    }
+    return out;
+  }
+
+  std::string json() const {
+    std::string out = "{\"operations\":[";
+    bool first = true;
+    for_each_histogram([&](const std::string &, const Histogram &h,
+                           Container container, Operation operation) {
+      out += first ? "" : ",";
+      first = false;
+      out += "{\"container\":\"" + std::string(name(container)) +
+             "\",\"operation\":\"" + name(operation) +
+             "\",\"count\":" + std::to_string(h.count()) +
+             ",\"sum_ns\":" + std::to_string(h.sum()) + ",\"buckets\":[";
+      for (size_t i = 0; i < Histogram::kBuckets; ++i) {
+        out += (i ? "," : "") + std::to_string(h.bucket(i));
+      }
+      out += "]}";
+    });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    out += "],\"reallocations\":[";
+    first = true;
+    for (const auto &[key, totals] : reallocations_) {
+      out += first ? "" : ",";
+      first = false;
+      out += "{\"container\":\"" +
+             std::string(name(static_cast<Container>(key.first))) +
+             "\",\"tag\":\"" + escape(key.second) +
+             "\",\"count\":" + std::to_string(totals.count) +
+             ",\"bytes\":" + std::to_string(totals.bytes) +
+             ",\"max_capacity\":" + std::to_string(totals.max_capacity) + "}";
+    }
+    out += "],\"recent\":[";
+    const size_t recent = std::min<std::uint64_t>(recorded_, kRecent);
+    for (size_t i = 0; i < recent; ++i) {
+      const Reallocation &event = recent_[(recorded_ - recent + i) % kRecent];
+      out += (i ? ",{" : "{");
+      out += "\"container\":\"" + std::string(name(event.container)) +
+             "\",\"tag\":\"" + escape(event.tag) +
+             "\",\"element_size\":" + std::to_string(event.element_size) +
+             ",\"size_before\":" + std::to_string(event.size_before) +
+             ",\"size_after\":" + std::to_string(event.size_after) +
+             ",\"capacity_before\":" + std::to_string(event.capacity_before) +
+             ",\"capacity_after\":" + std::to_string(event.capacity_after) +
+             "}";
+    }
+    out += "],\"dropped\":" + std::to_string(dropped_) + "}";
+    return out;
+  }
+
+private:
+  static constexpr size_t kContainers = static_cast<size_t>(Container::kCount);
+  static constexpr size_t kOperations = static_cast<size_t>(Operation::kCount);
+
+  Histogram histograms_[kContainers][kOperations];
+  mutable std::mutex mutex_;
+  std::map<std::pair<size_t, std::string>, TagTotals> reallocations_;
+  std::array<Reallocation, kRecent> recent_{};
+  std::uint64_t recorded_ = 0;
+  std::uint64_t dropped_ = 0;
+
+  // Обходит непустые гистограммы; f принимает метки Prometheus и
+  // гистограмму, а при желании ещё контейнер и операцию
+  template <typename F> void for_each_histogram(F f) const {
+    for (size_t c = 0; c < kContainers; ++c) {
+      for (size_t o = 0; o < kOperations; ++o) {
+        const Histogram &h = histograms_[c][o];
+        if (h.count() == 0) {
+          continue;
+        }
+        const auto container = static_cast<Container>(c);
+        const auto operation = static_cast<Operation>(o);
+        const std::string labels = "container=\"" +
+                                   std::string(name(container)) +
+                                   "\",operation=\"" + name(operation) + "\"";
+        if constexpr (std::is_invocable_v<F, const std::string &,
+                                          const Histogram &>) {
+          f(labels, h);
+        } else {
+          f(labels, h, container, operation);
+        }
+      }
+    }
+  }
+
+  static std::string tag_labels(const std::pair<size_t, std::string> &key) {
+    return "{container=\"" +
+           std::string(name(static_cast<Container>(key.first))) +
+           "\",tag=\"" + escape(key.second) + "\"}";
+  }
+
+  static std::string seconds(std::uint64_t nanoseconds) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", nanoseconds * 1e-9);
+    return buffer;
+  }
+
+  // Экранирование для строк JSON и значений меток Prometheus
+  static std::string escape(const std::string &text) {
+    std::string out;
+    for (char c : text) {
+      if (c == '"' || c == '\\') {
+        out += '\\';
+        out += c;
+      } else if (c == '\n') {
+        out += "\\n";
+      } else {
+        out += c;
+      }
+    }
+    return out;
+  }
+};
+
+} // end namespace telemetry
@@ -1,81 +1,370 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
+#include "check.hpp"
+#include "telemetry.hpp"
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace vector {
-template <typename T> class RawMemory {
+
+// Выравнивание буферов: строка кэша (она же ширина регистра AVX-512) и
+// страница
+constexpr size_t kCacheLineAlignment = 64;
+constexpr size_t kAvx512Alignment = 64;
+constexpr size_t kPageAlignment = 4096;
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+#ifndef VECTOR_HUGE_PAGE_THRESHOLD
+#define VECTOR_HUGE_PAGE_THRESHOLD (32 * 1024 * 1024)
+#endif
+
+inline std::atomic<size_t> &huge_page_threshold_storage() noexcept {
+  static std::atomic<size_t> threshold{VECTOR_HUGE_PAGE_THRESHOLD};
+  return threshold;
+}
+
+// Буферы не меньше порога (в байтах) выделяются через mmap с
+// MADV_HUGEPAGE. SIZE_MAX отключает режим
+inline size_t huge_page_threshold() noexcept {
+  return huge_page_threshold_storage().load(std::memory_order_relaxed);
+}
+
+inline void set_huge_page_threshold(size_t bytes) noexcept {
+  huge_page_threshold_storage().store(bytes, std::memory_order_relaxed);
+}
+
+// Размещение большого буфера по узлам NUMA. Local оставляет решение ядру,
+// Interleave чередует страницы между узлами, Bind привязывает буфер к node,
+// FirstTouch инициализирует элементы потоками, разбивая буфер так же, как
+// numa_partition_begin, — страницы оказываются рядом с тем, кто их обработает
+enum class NumaPlacement { Local, Interleave, Bind, FirstTouch };
+
+struct NumaPolicy {
+  NumaPlacement placement = NumaPlacement::Local;
+  int node = 0;
+  // Число потоков для FirstTouch, 0 — std::thread::hardware_concurrency()
+  size_t threads = 0;
+};
+
+// Число узлов NUMA по /sys/devices/system/node/online ("0" или "0-1")
+inline size_t numa_node_count() {
+  static const size_t count = [] {
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string line;
+    if (!std::getline(online, line) || line.empty()) {
+      return size_t{1};
+    }
+    const size_t last = line.find_last_of("-,");
+    return static_cast<size_t>(
+               std::stoul(last == std::string::npos ? line
+                                                    : line.substr(last + 1))) +
+           1;
+  }();
+  return count;
+}
+
+// Начало части index при делении size элементов на parts почти равных частей
+inline size_t numa_partition_begin(size_t size, size_t parts,
+                                   size_t index) noexcept {
+  return size / parts * index + std::min(index, size % parts);
+}
+
+// Узел, на котором сейчас лежит страница с address, или -1
+inline int numa_node_of(const void *address) noexcept {
+#if defined(__linux__) && defined(SYS_move_pages)
+  void *page = const_cast<void *>(address);
+  int status = -1;
+  if (syscall(SYS_move_pages, 0, 1, &page, nullptr, &status, 0) == 0) {
+    return status;
+  }
+#else
+  (void)address;
+#endif
+  return -1;
+}
+
+// Применяет Interleave/Bind к отображённому диапазону. На машине с одним
+// узлом и при ошибке mbind ничего не делает: память остаётся обычной
+inline void numa_apply(void *address, size_t bytes,
+                       const NumaPolicy &policy) noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+  const size_t nodes = numa_node_count();
+  if (nodes < 2 || nodes > sizeof(unsigned long) * 8) {
+    return;
+  }
+  unsigned long mask = 0;
+  int mode = MPOL_DEFAULT;
+  if (policy.placement == NumaPlacement::Interleave) {
+    mode = MPOL_INTERLEAVE;
+    mask = nodes == sizeof(unsigned long) * 8 ? ~0ul : (1ul << nodes) - 1;
+  } else if (policy.placement == NumaPlacement::Bind &&
+             policy.node >= 0 && static_cast<size_t>(policy.node) < nodes) {
+    mode = MPOL_BIND;
+    mask = 1ul << policy.node;
+  } else {
+    return;
+  }
+  syscall(SYS_mbind, address, bytes, mode, &mask, sizeof(mask) * 8 + 1, 0);
+#else
+  (void)address;
+  (void)bytes;
+  (void)policy;
+#endif
+}
+
+// Объект типа можно перенести побайтовым копированием, не вызывая
+// конструктор перемещения и деструктор исходного. Верно для тривиально
+// копируемых типов; остальные объявляют это специализацией
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+namespace detail {
+
+// Разрушение n объектов; для тривиально разрушаемых типов цикла нет вовсе
+template <typename T> void destroy_n(T *first, size_t n) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    std::destroy_n(first, n);
+  } else {
+    (void)first, (void)n;
+  }
+}
+
+// Копирование n объектов в неинициализированную память
+template <typename T> void copy_construct_n(const T *src, size_t n, T *dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (n != 0) {
+      std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                  n * sizeof(T));
+    }
+  } else {
+    std::uninitialized_copy_n(src, n, dst);
+  }
+}
+
+// Перенос n объектов в неинициализированную память с разрушением исходных.
+// Если перемещение может бросить, объекты копируются: при исключении
+// исходные остаются нетронутыми
+template <typename T> void relocate_n(T *src, size_t n, T *dst) {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    if (n != 0) {
+      std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                  n * sizeof(T));
+    }
+  } else {
+    if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                  !std::is_copy_constructible_v<T>) {
+      std::uninitialized_move_n(src, n, dst);
+    } else {
+      std::uninitialized_copy_n(src, n, dst);
+    }
+    detail::destroy_n(src, n);
+  }
+}
+
+} // namespace detail
+
+template <typename T, size_t Alignment = alignof(T)> class RawMemory {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "Alignment must be a power of two");
+  static_assert(Alignment >= alignof(T), "Alignment is weaker than alignof(T)");
+
 public:
   RawMemory() = default;
 
-  explicit RawMemory(size_t capacity)
-      : buffer_(allocate(capacity)), capacity_(capacity) {}
+  explicit RawMemory(size_t capacity) : capacity_(capacity) {
+    buffer_ = allocate(capacity, mapped_);
+  }
+
+  // Буфер всегда отображается через mmap, чтобы политику NUMA можно было
+  // применить к целым страницам, не задевая соседние выделения кучи.
+  // Политика запоминается и передаётся буферам из same_placement
+  RawMemory(size_t capacity, const NumaPolicy &policy)
+      : capacity_(capacity), policy_(policy) {
+#if defined(__linux__)
+    if (capacity > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    if (capacity != 0) {
+      buffer_ = static_cast<T *>(map_huge_pages(capacity * sizeof(T)));
+      mapped_ = true;
+      numa_apply(buffer_, mapped_length(capacity * sizeof(T)), policy);
+    }
+#else
+    (void)policy;
+    buffer_ = allocate(capacity, mapped_);
+#endif
+  }
 
-  ~RawMemory() { deallocate(buffer_); }
+  ~RawMemory() { deallocate(buffer_, capacity_, mapped_); }
 
   RawMemory(const RawMemory &) = delete;
   RawMemory &operator=(const RawMemory &rhs) = delete;
 
   RawMemory(RawMemory &&other) noexcept
       : buffer_(std::exchange(other.buffer_, nullptr)),
-        capacity_(std::exchange(other.capacity_, 0)) {}
+        capacity_(std::exchange(other.capacity_, 0)),
+        mapped_(std::exchange(other.mapped_, false)),
+        policy_(other.policy_) {}
+
+  // Новый буфер ёмкости capacity с той же политикой NUMA, что у этого
+  RawMemory same_placement(size_t capacity) const {
+    if (policy_.placement == NumaPlacement::Local) {
+      return RawMemory(capacity);
+    }
+    return RawMemory(capacity, policy_);
+  }
 
   RawMemory &operator=(RawMemory &&rhs) noexcept {
     if (this != &rhs) {
-      buffer_ = std::move(rhs.buffer_);
-      capacity_ = std::move(rhs.capacity_);
-      rhs.buffer_ = nullptr;
-      rhs.capacity_ = 0;
+      RawMemory old(std::move(*this));
+      swap(rhs);
     }
 
     return *this;
   }
 
-  T *operator+(size_t offset) noexcept {
-    if (offset <= capacity_) {
-      return buffer_ + offset;
-    }
+  T *operator+(size_t offset) noexcept(check::kNothrow) {
+    check::require(offset <= capacity_, "Incorrect Index");
+    return buffer_ + offset;
   }
 
-  const T *operator+(size_t offset) const noexcept {
+  const T *operator+(size_t offset) const noexcept(check::kNothrow) {
     return const_cast<RawMemory &>(*this) + offset;
   }
 
-  const T &operator[](size_t index) const noexcept {
+  const T &operator[](size_t index) const noexcept(check::kNothrow) {
     return const_cast<RawMemory &>(*this)[index];
   }
 
-  T &operator[](size_t index) {
-    if (index < capacity_) {
-      return buffer_[index];
-    } else {
-      throw std::out_of_range("Incorrect Index");
-    }
+  T &operator[](size_t index) noexcept(check::kNothrow) {
+    check::require(index < capacity_, "Incorrect Index");
+    return buffer_[index];
   }
 
   void swap(RawMemory &other) noexcept {
     std::swap(buffer_, other.buffer_);
     std::swap(capacity_, other.capacity_);
+    std::swap(mapped_, other.mapped_);
+    std::swap(policy_, other.policy_);
   }
 
   const T *get_address() const noexcept { return buffer_; }
   T *get_address() noexcept { return buffer_; }
   size_t capacity() const { return capacity_; }
+  // Буфер получен через mmap и помечен для прозрачных huge pages
+  bool is_huge_page_backed() const noexcept { return mapped_; }
+  const NumaPolicy &numa_policy() const noexcept { return policy_; }
 
 private:
   T *buffer_ = nullptr;
   size_t capacity_ = 0;
+  bool mapped_ = false;
+  NumaPolicy policy_;
+
+  static constexpr bool kOverAligned =
+      Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  static T *allocate(size_t n, bool &mapped) {
+    mapped = false;
+    if (n == 0) {
+      return nullptr;
+    }
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    const size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+    if (bytes >= huge_page_threshold()) {
+      mapped = true;
+      return static_cast<T *>(map_huge_pages(bytes));
+    }
+#endif
+    if constexpr (kOverAligned) {
+      return static_cast<T *>(
+          operator new(bytes, std::align_val_t{Alignment}));
+    } else {
+      return static_cast<T *>(operator new(bytes));
+    }
+  }
 
-  static T *allocate(size_t n) {
-    return n != 0 ? static_cast<T *>(operator new(n * sizeof(T))) : nullptr;
+  static void deallocate(T *buf, size_t n, bool mapped) noexcept {
+#if defined(__linux__)
+    if (mapped) {
+      munmap(buf, mapped_length(n * sizeof(T)));
+      return;
+    }
+#else
+    (void)mapped;
+#endif
+    (void)n;
+    if constexpr (kOverAligned) {
+      operator delete(buf, std::align_val_t{Alignment});
+    } else {
+      operator delete(buf);
+    }
+  }
+
+#if defined(__linux__)
+  static size_t mapped_length(size_t bytes) noexcept {
+    return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
   }
-  static void deallocate(T *buf) noexcept { operator delete(buf); }
+
+  // Отображение с запасом в одну huge page, лишнее по краям возвращается
+  // системе, чтобы буфер начинался на границе 2 МБ
+  static void *map_huge_pages(size_t bytes) {
+    const size_t length = mapped_length(bytes);
+    void *raw = mmap(nullptr, length + kHugePageSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+    const uintptr_t aligned =
+        (begin + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+    if (aligned > begin) {
+      munmap(raw, aligned - begin);
+    }
+    const uintptr_t end = begin + length + kHugePageSize;
+    if (end > aligned + length) {
+      munmap(reinterpret_cast<void *>(aligned + length),
+             end - (aligned + length));
+    }
+    void *buffer = reinterpret_cast<void *>(aligned);
+#if defined(MADV_HUGEPAGE)
+    madvise(buffer, length, MADV_HUGEPAGE);
+#endif
+    return buffer;
+  }
+#endif
 };
 
-template <typename T> class Vector {
+template <typename T, size_t Alignment = alignof(T)> class Vector {
 public:
   using iterator = T *;
   using const_iterator = const T *;
@@ -86,15 +375,56 @@ public:
     std::uninitialized_value_construct_n(data_.get_address(), size);
   }
 
-  Vector(const Vector &other) : data_(other.size_), size_(other.size_) {
-    std::uninitialized_copy_n(other.data_.get_address(), size_,
-                              data_.get_address());
+  // Вектор из size элементов с заданным размещением по узлам NUMA. Для
+  // FirstTouch элементы создаются параллельно, если конструктор не бросает.
+  // Политика сохраняется при росте, сжатии и копировании вектора; буфер
+  // копии или нового размера снова размечается по Interleave/Bind, а
+  // FirstTouch действует только здесь: при переносе элементы создаёт один
+  // поток
+  Vector(size_t size, const NumaPolicy &policy) : data_(size, policy) {
+    T *buffer = data_.get_address();
+    size_t threads =
+        policy.threads ? policy.threads : std::thread::hardware_concurrency();
+    if (policy.placement != NumaPlacement::FirstTouch || threads < 2 ||
+        !std::is_nothrow_default_constructible_v<T>) {
+      std::uninitialized_value_construct_n(buffer, size);
+    } else {
+      threads = std::min(threads, std::max<size_t>(size, 1));
+      Vector<std::thread> workers;
+      workers.reserve(threads);
+      size_t started = 0;
+      try {
+        for (; started < threads; ++started) {
+          const size_t first = numa_partition_begin(size, threads, started);
+          const size_t last = numa_partition_begin(size, threads, started + 1);
+          workers.emplace_back([buffer, first, last] {
+            std::uninitialized_value_construct(buffer + first, buffer + last);
+          });
+        }
+      } catch (const std::system_error &) {
+        // Не удалось запустить поток: оставшиеся части заполняет текущий
+      }
+      std::uninitialized_value_construct(
+          buffer + numa_partition_begin(size, threads, started), buffer + size);
+      for (std::thread &worker : workers) {
+        worker.join();
+      }
+    }
+    size_ = size;
+  }
+
+  Vector(const Vector &other)
+      : data_(other.data_.same_placement(other.size_)), size_(other.size_),
+        shrink_ratio_(other.shrink_ratio_) {
+    detail::copy_construct_n(other.data_.get_address(), size_,
+                             data_.get_address());
   }
 
   Vector(Vector &&other) noexcept
-      : data_(std::move(other.data_)), size_(std::exchange(other.size_, 0)) {}
+      : data_(std::move(other.data_)), size_(std::exchange(other.size_, 0)),
+        shrink_ratio_(other.shrink_ratio_) {}
 
-  ~Vector() { std::destroy_n(data_.get_address(), size_); }
+  ~Vector() { detail::destroy_n(data_.get_address(), size_); }
 
   iterator begin() noexcept { return data_.get_address(); }
   iterator end() noexcept { return size_ + data_.get_address(); }
@@ -103,43 +433,74 @@ public:
   const_iterator begin() const noexcept { return cbegin(); }
   const_iterator end() const noexcept { return cend(); }
 
+  T *data() noexcept { return data_.get_address(); }
+  const T *data() const noexcept { return data_.get_address(); }
+
   size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
   size_t capacity() const noexcept { return data_.capacity(); }
+  const NumaPolicy &numa_policy() const noexcept { return data_.numa_policy(); }
   void swap(Vector &other) noexcept {
     data_.swap(other.data_), std::swap(size_, other.size_);
+    std::swap(shrink_ratio_, other.shrink_ratio_);
   }
 
+  // Байты, занятые вектором: сам объект и весь буфер, включая незанятую
+  // ёмкость
+  size_t memory_usage() const noexcept {
+    return sizeof(*this) + data_.capacity() * sizeof(T);
+  }
+
+  // Автоматическое сжатие: если после удаления элементов size * ratio <
+  // capacity, буфер уменьшается до size * ratio / 2 — в два раза меньше
+  // порога. Запас не даёт чередованию вставок и удалений перевыделять
+  // память на каждом шаге. 0 — выключено, 1 работает как 2
+  void set_shrink_ratio(size_t ratio) noexcept { shrink_ratio_ = ratio; }
+  size_t shrink_ratio() const noexcept { return shrink_ratio_; }
+
   void reserve(size_t new_capacity) {
-    if (new_capacity <= data_.capacity()) {
-      return;
+    if (new_capacity > data_.capacity()) {
+      reallocate(new_capacity);
     }
+  }
 
-    RawMemory<T> new_data(new_capacity);
-    if constexpr (std::is_nothrow_move_constructible_v<T> ||
-                  !std::is_copy_constructible_v<T>) {
-      std::uninitialized_move_n(data_.getAddress(), size_,
-                                new_data.getAddress());
-    } else {
-      std::uninitialized_copy_n(data_.getAddress(), size_,
-                                new_data.getAddress());
+  // Уменьшает ёмкость до размера
+  void shrink_to_fit() {
+    if (size_ < data_.capacity()) {
+      reallocate(size_);
     }
-    std::destroy_n(data_.getAddress(), size_);
-    data_.swap(new_data);
   }
 
   void resize(size_t new_size) {
     if (new_size < size_) {
-      std::destroy_n(data_.getAddress() + new_size, size_ - new_size);
+      detail::destroy_n(data_.get_address() + new_size, size_ - new_size);
     } else {
       if (new_size > data_.capacity()) {
         const size_t new_capacity = std::max(data_.capacity() * 2, new_size);
         reserve(new_capacity);
       }
-      std::uninitialized_value_construct_n(data_.getAddress() + size_,
+      std::uninitialized_value_construct_n(data_.get_address() + size_,
                                            new_size - size_);
     }
 
     size_ = new_size;
+    maybe_shrink();
+  }
+
+  // Как resize, но новые элементы инициализируются по умолчанию: память
+  // тривиальных типов не заполняется, её сразу перезапишет вызывающий
+  // (например, чтение файла). Ёмкость выделяется ровно под new_size
+  void resize_for_overwrite(size_t new_size) {
+    if (new_size < size_) {
+      detail::destroy_n(data_.get_address() + new_size, size_ - new_size);
+    } else {
+      reserve(new_size);
+      std::uninitialized_default_construct_n(data_.get_address() + size_,
+                                             new_size - size_);
+    }
+
+    size_ = new_size;
+    maybe_shrink();
   }
 
   void print() {
@@ -166,50 +527,81 @@ public:
   }
 
   iterator erase(const_iterator pos) {
-    if (pos >= begin() && pos < end()) {
-      size_t position = pos - begin();
+    telemetry::Scope scope(telemetry::Container::Vector,
+                           telemetry::Operation::Erase);
+    check::require(pos >= begin() && pos < end(), "Incorrect Index");
+    size_t position = pos - begin();
 
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memmove(static_cast<void *>(begin() + position),
+                   static_cast<const void *>(begin() + position + 1),
+                   (size_ - position - 1) * sizeof(T));
+    } else {
       std::move(begin() + position + 1, end(), begin() + position);
       std::destroy_at(end() - 1);
-      size_ -= 1;
-
-      return (begin() + position);
-    } else {
-      throw std::out_of_range("Incorrect Index");
     }
+    size_ -= 1;
+    maybe_shrink();
+
+    return (begin() + position);
   }
 
   template <typename Type> void push_back(Type &&value);
 
   void pop_back() {
     if (size_) {
-      std::destroy_at(data_.get_address() + size_ - 1);
+      detail::destroy_n(data_.get_address() + size_ - 1, 1);
       --size_;
+      maybe_shrink();
     }
   }
 
+  void clear() noexcept {
+    telemetry::Scope scope(telemetry::Container::Vector,
+                           telemetry::Operation::Clear);
+    detail::destroy_n(data_.get_address(), size_);
+    size_ = 0;
+  }
+
+  // Очищает вектор и возвращает буфер системе
+  void clear_and_release() noexcept {
+    clear();
+    data_ = RawMemory<T, Alignment>(0, data_.numa_policy());
+  }
+
+  // Буфер, который больше копируемых данных в kOversizedRatio раз и более,
+  // не переиспользуется, а заменяется буфером по размеру
   Vector &operator=(const Vector &other) {
     if (this != &other) {
-      if (other.size_ <= data_.capacity()) {
-        if (size_ <= other.size_) {
-          std::copy(other.data_.getAddress(), other.data_.getAddress() + size_,
-                    data_.getAddress());
-
-          std::uninitialized_copy_n(other.data_.getAddress() + size_,
+      if (other.size_ <= data_.capacity() &&
+          other.size_ * kOversizedRatio >= data_.capacity()) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+          detail::copy_construct_n(other.data_.get_address(), other.size_,
+                                   data_.get_address());
+        } else if (size_ <= other.size_) {
+          std::copy(other.data_.get_address(), other.data_.get_address() + size_,
+                    data_.get_address());
+
+          std::uninitialized_copy_n(other.data_.get_address() + size_,
                                     other.size_ - size_,
-                                    data_.getAddress() + size_);
+                                    data_.get_address() + size_);
         } else {
-          std::copy(other.data_.getAddress(),
-                    other.data_.getAddress() + other.size_, data_.getAddress());
+          std::copy(other.data_.get_address(),
+                    other.data_.get_address() + other.size_, data_.get_address());
 
-          std::destroy_n(data_.getAddress() + other.size_, size_ - other.size_);
+          std::destroy_n(data_.get_address() + other.size_, size_ - other.size_);
         }
 
         size_ = other.size_;
 
       } else {
-        Vector other_copy(other);
-        swap(other_copy);
+        // Новый буфер получает политику NUMA этого вектора, а не other
+        RawMemory<T, Alignment> new_data = data_.same_placement(other.size_);
+        detail::copy_construct_n(other.data_.get_address(), other.size_,
+                                 new_data.get_address());
+        detail::destroy_n(data_.get_address(), size_);
+        data_.swap(new_data);
+        size_ = other.size_;
       }
     }
 
@@ -221,35 +613,130 @@ public:
     return *this;
   }
 
-  const T &operator[](size_t index) const noexcept {
+  // Проверка индекса зависит от CONTAINERS_CHECK_LEVEL (check.hpp); без
+  // проверки обращение компилируется в одну загрузку
+  const T &operator[](size_t index) const noexcept(check::kNothrow) {
     return const_cast<Vector &>(*this)[index];
   }
-  T &operator[](size_t index) noexcept { return data_[index]; }
+  T &operator[](size_t index) noexcept(check::kNothrow) {
+    check::require(index < size_, "Incorrect Index");
+    return data_.get_address()[index];
+  }
+
+  // Индекс проверяется всегда, при выходе за размер — std::out_of_range
+  const T &at(size_t index) const { return const_cast<Vector &>(*this).at(index); }
+  T &at(size_t index) {
+    check::always(index < size_, "Incorrect Index");
+    return data_.get_address()[index];
+  }
 
 private:
-  RawMemory<T> data_;
-  size_t size_ = 0;
-};
+  static constexpr size_t kOversizedRatio = 4;
 
-template <typename T>
-template <typename Type>
-void Vector<T>::push_back(Type &&value) {
-  if (data_.capacity() <= size_) {
-    RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+  RawMemory<T, Alignment> data_;
+  size_t size_ = 0;
+  size_t shrink_ratio_ = 0;
+
+  void reallocate(size_t new_capacity) {
+    telemetry::Scope scope(telemetry::Container::Vector,
+                           telemetry::Operation::Grow);
+    telemetry::reallocation(telemetry::Container::Vector, sizeof(T), size_,
+                            size_, data_.capacity(), new_capacity);
+    RawMemory<T, Alignment> new_data = data_.same_placement(new_capacity);
+    relocate_to(new_data, size_);
+  }
 
-    new (new_data.get_address() + size_) T(std::forward<Type>(value));
+  // Перераспределение с созданием нового элемента в позиции position.
+  // Элемент создаётся до переноса, так как аргументы могут ссылаться на
+  // элементы вектора. Строгая гарантия: если создание или перенос бросит,
+  // новый элемент разрушается, а вектор остаётся прежним
+  template <typename... Args>
+  void grow_emplace(size_t position, Args &&...args) {
+    const size_t new_capacity = size_ == 0 ? 1 : size_ * 2;
+    telemetry::Scope scope(telemetry::Container::Vector,
+                           telemetry::Operation::Grow);
+    telemetry::reallocation(telemetry::Container::Vector, sizeof(T), size_,
+                            size_ + 1, data_.capacity(), new_capacity);
+    RawMemory<T, Alignment> new_data = data_.same_placement(new_capacity);
+    T *slot = new_data.get_address() + position;
+    new (slot) T(std::forward<Args>(args)...);
+    try {
+      relocate_to(new_data, position);
+    } catch (...) {
+      std::destroy_at(slot);
+      throw;
+    }
+  }
 
-    if constexpr (std::is_nothrow_move_constructible_v<T> ||
-                  !std::is_copy_constructible_v<T>) {
-      std::uninitialized_move_n(data_.get_address(), size_,
-                                new_data.get_address());
+  // Переносит элементы в new_data, оставляя неинициализированной позицию
+  // gap (gap == size_ — без пропуска), и делает new_data текущим буфером.
+  // Как std::move_if_noexcept: элементы перемещаются, если перемещение не
+  // бросает или копирование невозможно, иначе копируются, и при исключении
+  // вектор не меняется. Исключение — типы без копирования с бросающим
+  // перемещением: вектор сохраняет размер и остаётся корректным, но часть
+  // элементов может оказаться перемещённой (базовая гарантия)
+  void relocate_to(RawMemory<T, Alignment> &new_data, size_t gap) {
+    T *src = data_.get_address();
+    T *dst = new_data.get_address();
+    if constexpr (is_trivially_relocatable_v<T> ||
+                  std::is_nothrow_move_constructible_v<T>) {
+      detail::relocate_n(src, gap, dst);
+      if (gap < size_) {
+        detail::relocate_n(src + gap, size_ - gap, dst + gap + 1);
+      }
     } else {
-      std::uninitialized_copy_n(data_.get_address(), size_,
-                                new_data.get_address());
+      // Перенос может бросить: исходные элементы разрушаются только после
+      // того, как перенесены все, а при исключении разрушаются уже
+      // созданные в new_data
+      auto transfer = [](T *from, size_t n, T *to) {
+        if constexpr (std::is_copy_constructible_v<T>) {
+          std::uninitialized_copy_n(from, n, to);
+        } else {
+          std::uninitialized_move_n(from, n, to);
+        }
+      };
+      transfer(src, gap, dst);
+      if (gap < size_) {
+        try {
+          transfer(src + gap, size_ - gap, dst + gap + 1);
+        } catch (...) {
+          std::destroy_n(dst, gap);
+          throw;
+        }
+      }
+      std::destroy_n(src, size_);
     }
-
-    std::destroy_n(data_.get_address(), size_);
     data_.swap(new_data);
+  }
+
+  // Сжатие — лишь оптимизация: если новый буфер выделить не удалось,
+  // вектор остаётся в прежнем буфере
+  // Новая ёмкость не меньше size и строго меньше прежней: буфер только
+  // уменьшается
+  void maybe_shrink() noexcept {
+    if (shrink_ratio_ == 0) {
+      return;
+    }
+    const size_t ratio = std::max<size_t>(shrink_ratio_, 2);
+    if (size_ * ratio >= data_.capacity()) {
+      return;
+    }
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+      try {
+        reallocate(size_ * ratio / 2);
+      } catch (const std::bad_alloc &) {
+      }
+    }
+  }
+};
+
+template <typename T, size_t Alignment>
+template <typename Type>
+void Vector<T, Alignment>::push_back(Type &&value) {
+  telemetry::Scope scope(telemetry::Container::Vector,
+                         telemetry::Operation::Push);
+  if (data_.capacity() <= size_) {
+    grow_emplace(size_, std::forward<Type>(value));
 
   } else {
     new (data_.get_address() + size_) T(std::forward<Type>(value));
@@ -258,25 +745,13 @@ void Vector<T>::push_back(Type &&value) {
   size_++;
 }
 
-template <typename T>
+template <typename T, size_t Alignment>
 template <typename... Args>
-T &Vector<T>::emplace_back(Args &&...args) {
+T &Vector<T, Alignment>::emplace_back(Args &&...args) {
+  telemetry::Scope scope(telemetry::Container::Vector,
+                         telemetry::Operation::Push);
   if (data_.capacity() <= size_) {
-    RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-
-    new (new_data.getAddress() + size_) T(std::forward<Args>(args)...);
-
-    if constexpr (std::is_nothrow_move_constructible_v<T> ||
-                  !std::is_copy_constructible_v<T>) {
-      std::uninitialized_move_n(data_.get_address(), size_,
-                                new_data.get_address());
-    } else {
-      std::uninitialized_copy_n(data_.get_address(), size_,
-                                new_data.get_address());
-    }
-
-    std::destroy_n(data_.get_address(), size_);
-    data_.swap(new_data);
+    grow_emplace(size_, std::forward<Args>(args)...);
 
   } else {
     new (data_.get_address() + size_) T(std::forward<Args>(args)...);
@@ -285,65 +760,60 @@ T &Vector<T>::emplace_back(Args &&...args) {
   return data_[size_++];
 }
 
-template <typename T>
+template <typename T, size_t Alignment>
 template <typename... Args>
-typename Vector<T>::iterator Vector<T>::emplace(const_iterator pos,
-                                                Args &&...args) {
-  if (pos >= begin() && pos <= end()) {
-    size_t position = pos - begin();
-
-    if (data_.capacity() <= size_) {
-      RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-
-      new (new_data.get_address() + position) T(std::forward<Args>(args)...);
+typename Vector<T, Alignment>::iterator
+Vector<T, Alignment>::emplace(const_iterator pos, Args &&...args) {
+  telemetry::Scope scope(telemetry::Container::Vector,
+                         telemetry::Operation::Insert);
+  check::require(pos >= begin() && pos <= end(), "Incorrect Index");
+  size_t position = pos - begin();
 
-      if constexpr (std::is_nothrow_move_constructible_v<T> ||
-                    !std::is_copy_constructible_v<T>) {
-        std::uninitialized_move_n(data_.get_address(), position,
-                                  new_data.get_address());
-        std::uninitialized_move_n(data_.get_address() + position,
-                                  size_ - position,
-                                  new_data.get_address() + position + 1);
-
-      } else {
-        std::uninitialized_copy_n(data_.get_address(), position,
-                                  new_data.get_address());
-        std::uninitialized_copy_n(data_.get_address() + position,
-                                  size_ - position,
-                                  new_data.get_address() + position + 1);
-      }
+  if (data_.capacity() <= size_) {
+    grow_emplace(position, std::forward<Args>(args)...);
 
-      std::destroy_n(data_.get_address(), size_);
-      data_.swap(new_data);
+  } else {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      // Значение создаётся до сдвига: аргументы могут ссылаться на
+      // элементы самого вектора
+      T new_s(std::forward<Args>(args)...);
+      std::memmove(static_cast<void *>(begin() + position + 1),
+                   static_cast<const void *>(begin() + position),
+                   (size_ - position) * sizeof(T));
+      new (begin() + position) T(new_s);
+    } else if (pos != end()) {
+      T new_s(std::forward<Args>(args)...);
+      new (end()) T(std::forward<T>(data_[size_ - 1]));
+      // Новый последний элемент уже создан и принадлежит вектору: если
+      // сдвиг бросит, все элементы останутся живыми (базовая гарантия).
+      // При небросающем перемещении исключение возможно только из
+      // конструктора new_s, и вектор не меняется
+      size_++;
+
+      std::move_backward(begin() + position, end() - 2, end() - 1);
+      *(begin() + position) = std::forward<T>(new_s);
+      return begin() + position;
 
     } else {
-      try {
-        if (pos != end()) {
-          T new_s(std::forward<Args>(args)...);
-          new (end()) T(std::forward<T>(data_[size_ - 1]));
-
-          std::move_backward(begin() + position, end() - 1, end());
-          *(begin() + position) = std::forward<T>(new_s);
-
-        } else {
-          new (end()) T(std::forward<Args>(args)...);
-        }
-
-      } catch (...) {
-        operator delete(end());
-        throw;
-      }
+      new (end()) T(std::forward<Args>(args)...);
     }
-
-    size_++;
-    return begin() + position;
-  } else {
-    throw std::out_of_range("Incorrect Index");
   }
+
+  size_++;
+  return begin() + position;
 }
 
-template <typename T>
-bool operator==(const Vector<T> &lhs, const Vector<T> &rhs) {
+// Vector хранит только указатель на буфер и счётчики, поэтому его можно
+// переносить побайтово независимо от T
+template <typename T, size_t Alignment>
+struct is_trivially_relocatable<RawMemory<T, Alignment>> : std::true_type {};
+
+template <typename T, size_t Alignment>
+struct is_trivially_relocatable<Vector<T, Alignment>> : std::true_type {};
+
+template <typename T, size_t Alignment>
+bool operator==(const Vector<T, Alignment> &lhs,
+                const Vector<T, Alignment> &rhs) {
   return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 